@@ -762,7 +762,9 @@ class StubGenerator: public StubCodeGenerator {
       // Falling out the bottom means we found a hit; we ARE a subtype
 
       // Success.  Cache the super we found and proceed in triumph.
-      __ str(super_klass, Address(sub_klass, sc_offset));
+      if (UseSecondarySuperCache) {
+        __ str(super_klass, Address(sub_klass, sc_offset));
+      }
 
       // Return success
       // R0 is already 0 and flags are already set to eq
@@ -2424,7 +2426,9 @@ class StubGenerator: public StubCodeGenerator {
     // Falling out the bottom means we found a hit; we ARE a subtype
 
     // Success.  Cache the super we found and proceed in triumph.
-    __ str(super_klass, Address(sub_klass, sc_offset));
+    if (UseSecondarySuperCache) {
+      __ str(super_klass, Address(sub_klass, sc_offset));
+    }
 
     // Jump to success
     __ b(L_success);
@@ -1877,6 +1877,10 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  return page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
@@ -1898,6 +1902,10 @@ int os::numa_get_group_id() {
   return 0;
 }
 
+bool os::numa_bind_current_thread(int lgrp_id) {
+  return false;
+}
+
 size_t os::numa_get_leaf_groups(uint *ids, size_t size) {
   if (size > 0) {
     ids[0] = 0;
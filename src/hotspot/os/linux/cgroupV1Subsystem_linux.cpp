@@ -214,6 +214,17 @@ jlong CgroupV1Subsystem::memory_max_usage_in_bytes() {
   return memmaxusage;
 }
 
+jlong CgroupV1Subsystem::memory_throttle_limit_in_bytes() {
+  // memory.high and pressure stall information are cgroup v2 only.
+  log_trace(os, container)("Memory Throttle Limit is not supported.");
+  return OSCONTAINER_ERROR; // not supported
+}
+
+double CgroupV1Subsystem::memory_pressure() {
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR; // not supported
+}
+
 
 jlong CgroupV1Subsystem::kernel_memory_usage_in_bytes() {
   GET_CONTAINER_INFO(jlong, _memory->controller(), "/memory.kmem.usage_in_bytes",
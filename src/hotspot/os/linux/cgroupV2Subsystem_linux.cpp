@@ -139,6 +139,44 @@ jlong CgroupV2Subsystem::memory_max_usage_in_bytes() {
   return OSCONTAINER_ERROR; // not supported
 }
 
+/* memory_throttle_limit_in_bytes
+ *
+ * Return the memory.high limit above which the processes of this cgroup
+ * are throttled and put under heavy reclaim pressure.
+ *
+ * return:
+ *    memory throttle limit in bytes or
+ *    -1 for unlimited
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong CgroupV2Subsystem::memory_throttle_limit_in_bytes() {
+  char* mem_throttle_limit_str = mem_throttle_limit_val();
+  return limit_from_str(mem_throttle_limit_str);
+}
+
+/* memory_pressure
+ *
+ * Return the share of wall clock time, in percent and averaged over
+ * the last 10 seconds, in which at least one task of this cgroup was
+ * stalled on memory. This is the avg10 value of the "some" line of
+ * memory.pressure.
+ *
+ * return:
+ *    memory pressure in percent or
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2Subsystem::memory_pressure() {
+  GET_CONTAINER_INFO(double, _unified, "/memory.pressure",
+                     "Memory Pressure is: ", "%1.2f", "some avg10=%lf", pressure);
+  return pressure;
+}
+
+char* CgroupV2Subsystem::mem_throttle_limit_val() {
+  GET_CONTAINER_INFO_CPTR(cptr, _unified, "/memory.high",
+                         "Memory Throttle Limit is: %s", "%1023s", mem_throttle_limit_str, 1024);
+  return os::strdup(mem_throttle_limit_str);
+}
+
 char* CgroupV2Subsystem::mem_soft_limit_val() {
   GET_CONTAINER_INFO_CPTR(cptr, _unified, "/memory.low",
                          "Memory Soft Limit is: %s", "%1023s", mem_soft_limit_str, 1024);
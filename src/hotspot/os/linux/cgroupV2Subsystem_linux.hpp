@@ -60,6 +60,7 @@ class CgroupV2Subsystem: public CgroupSubsystem {
     char *mem_swp_limit_val();
     char *mem_swp_current_val();
     char *mem_soft_limit_val();
+    char *mem_throttle_limit_val();
     char *cpu_quota_val();
     char *pids_max_val();
 
@@ -78,6 +79,8 @@ class CgroupV2Subsystem: public CgroupSubsystem {
     jlong memory_soft_limit_in_bytes();
     jlong memory_usage_in_bytes();
     jlong memory_max_usage_in_bytes();
+    jlong memory_throttle_limit_in_bytes();
+    double memory_pressure();
 
     char * cpu_cpuset_cpus();
     char * cpu_cpuset_memory_nodes();
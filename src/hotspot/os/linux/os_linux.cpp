@@ -2197,6 +2197,23 @@ bool os::Linux::query_process_memory_info(os::Linux::meminfo_t* info) {
   return false;
 }
 
+// Returns the amount of anonymous memory backed by transparent huge pages, in K,
+// or -1 if that cannot be determined.
+static ssize_t query_anon_huge_pages() {
+  FILE* f = os::fopen("/proc/self/smaps_rollup", "r");
+  ssize_t result = -1;
+  char buf[256];
+  if (f != nullptr) {
+    while (::fgets(buf, sizeof(buf), f) != nullptr) {
+      if (sscanf(buf, "AnonHugePages: " SSIZE_FORMAT " kB", &result) == 1) {
+        break;
+      }
+    }
+    fclose(f);
+  }
+  return result;
+}
+
 #ifdef __GLIBC__
 // For Glibc, print a one-liner with the malloc tunables.
 // Most important and popular is MALLOC_ARENA_MAX, but we are
@@ -2243,6 +2260,15 @@ void os::Linux::print_process_memory_info(outputStream* st) {
     if (info.vmswap != -1) { // requires kernel >= 2.6.34
       st->print_cr("Swapped out: " SSIZE_FORMAT "K", info.vmswap);
     }
+    // With THP, report how much of the anonymous memory huge pages back. In madvise
+    // mode khugepaged collapses pages lazily, so this can lag well behind the heap size.
+    if (HugePages::supports_thp() && info.rssanon > 0) {
+      const ssize_t anon_huge = query_anon_huge_pages();
+      if (anon_huge != -1) { // requires kernel >= 4.14
+        st->print_cr("Transparent huge pages: " SSIZE_FORMAT "K (%.1f%% of anon)",
+                     anon_huge, (double)anon_huge * 100.0 / (double)info.rssanon);
+      }
+    }
   } else {
     st->print_cr("Could not open /proc/self/status to get process memory related information");
   }
@@ -2825,6 +2851,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
 // Note that the value for MAP_FIXED_NOREPLACE differs between architectures, but all architectures
 // supported by OpenJDK share the same flag value.
 #define MAP_FIXED_NOREPLACE_value 0x100000
@@ -2869,6 +2900,38 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
+  if (HugePages::thp_mode() != THPMode::always && !UseTransparentHugePages) {
+    return page_size;
+  }
+  // With THP, touching the range page by page makes the kernel fault in small
+  // pages first, which only later (if ever) get collapsed into huge pages.
+  // Having the kernel populate the whole range is both faster and lets it
+  // allocate huge pages right away.  The population is write-fault based and
+  // does not change the contents, so it is safe while the memory is in use.
+  static volatile bool populate_unsupported = false;
+  static volatile bool populate_failure_logged = false;
+  if (!Atomic::load(&populate_unsupported)) {
+    const size_t len = pointer_delta(last, first, sizeof(char)) + page_size;
+    if (::madvise(first, len, MADV_POPULATE_WRITE) == 0) {
+      return 0;
+    }
+    const int err = errno;
+    if (err == EINVAL) {
+      // Kernels before 5.14 do not know about MADV_POPULATE_WRITE.
+      Atomic::store(&populate_unsupported, true);
+    }
+    if (!Atomic::load(&populate_failure_logged) && !Atomic::cmpxchg(&populate_failure_logged, false, true)) {
+      log_info(os)("madvise(MADV_POPULATE_WRITE) failed for " PTR_FORMAT " (" SIZE_FORMAT " bytes): %s, "
+                   "falling back to touching pages", p2i(first), len, os::strerror(err));
+    }
+  }
+  // Fall back to touching pages. The OS will initially always use small pages
+  // for THP backed memory, but explicit large pages are backed by large pages
+  // right away, even if THP mode is "always".
+  return UseTransparentHugePages ? os::vm_page_size() : page_size;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -2919,6 +2982,12 @@ int os::numa_get_group_id() {
   return 0;
 }
 
+bool os::numa_bind_current_thread(int lgrp_id) {
+  // numa_run_on_node() restricts the thread to the CPUs of the node; the
+  // kernel further limits that to the CPUs allowed by the cgroup cpuset.
+  return Linux::numa_run_on_node(lgrp_id) == 0;
+}
+
 int os::numa_get_group_id_for_address(const void* address) {
   void** pages = const_cast<void**>(&address);
   int id = -1;
@@ -3085,6 +3154,8 @@ bool os::Linux::libnuma_init() {
                                          libnuma_dlsym(handle, "numa_move_pages")));
       set_numa_set_preferred(CAST_TO_FN_PTR(numa_set_preferred_func_t,
                                             libnuma_dlsym(handle, "numa_set_preferred")));
+      set_numa_run_on_node(CAST_TO_FN_PTR(numa_run_on_node_func_t,
+                                          libnuma_dlsym(handle, "numa_run_on_node")));
 
       if (numa_available() != -1) {
         set_numa_all_nodes((unsigned long*)libnuma_dlsym(handle, "numa_all_nodes"));
@@ -3273,6 +3344,7 @@ os::Linux::numa_get_membind_func_t os::Linux::_numa_get_membind;
 os::Linux::numa_get_interleave_mask_func_t os::Linux::_numa_get_interleave_mask;
 os::Linux::numa_move_pages_func_t os::Linux::_numa_move_pages;
 os::Linux::numa_set_preferred_func_t os::Linux::_numa_set_preferred;
+os::Linux::numa_run_on_node_func_t os::Linux::_numa_run_on_node;
 os::Linux::NumaAllocationPolicy os::Linux::_current_numa_policy;
 unsigned long* os::Linux::_numa_all_nodes;
 struct bitmask* os::Linux::_numa_all_nodes_ptr;
@@ -4964,9 +5036,16 @@ jlong os::thread_cpu_time(Thread* thread) {
 jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return os::Linux::fast_thread_cpu_time(CLOCK_THREAD_CPUTIME_ID);
-  } else {
-    return slow_thread_cpu_time(Thread::current(), user_sys_cpu_time);
+  } else if (!user_sys_cpu_time) {
+    // The user time of the calling thread is available without
+    // reading and parsing /proc.
+    struct rusage usage;
+    if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+      return (jlong)usage.ru_utime.tv_sec * NANOUNITS +
+             (jlong)usage.ru_utime.tv_usec * (NANOUNITS / MICROUNITS);
+    }
   }
+  return slow_thread_cpu_time(Thread::current(), user_sys_cpu_time);
 }
 
 jlong os::thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
@@ -4989,14 +5068,19 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
+  ssize_t bytes;
+  int fd;
 
+  // This is called for every thread by ThreadMXBean user time queries
+  // so read the file directly instead of setting up a buffered stream.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  fd = os::open(proc_name, O_RDONLY, 0);
+  if (fd == -1) return -1;
+  bytes = ::read(fd, stat, sizeof(stat) - 1);
+  ::close(fd);
+  if (bytes <= 0) return -1;
+  statlen = (size_t)bytes;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
@@ -5361,3 +5445,18 @@ bool os::trim_native_heap(os::size_change_t* rss_change) {
   return false; // musl
 #endif
 }
+
+size_t os::native_heap_free_bytes() {
+#ifdef __GLIBC__
+  os::Linux::glibc_mallinfo mi;
+  bool might_have_wrapped = false;
+  os::Linux::get_mallinfo(&mi, &might_have_wrapped);
+  if (might_have_wrapped) {
+    return SIZE_MAX;
+  }
+  // Free chunks in the arenas, including fastbin chunks.
+  return mi.fordblks;
+#else
+  return SIZE_MAX; // musl
+#endif
+}
@@ -304,6 +304,21 @@ static int util_posix_fallocate(int fd, off_t offset, off_t len) {
 #endif
 }
 
+void os::prefetch_memory(char *addr, size_t bytes) {
+  // We don't check the return value: this is only a hint.
+  ::madvise(addr, bytes, MADV_WILLNEED);
+}
+
+bool os::page_fault_counts(jlong* minor_faults, jlong* major_faults) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return false;
+  }
+  *minor_faults = (jlong)usage.ru_minflt;
+  *major_faults = (jlong)usage.ru_majflt;
+  return true;
+}
+
 // Map the given address range to the provided file descriptor.
 char* os::map_memory_to_file(char* base, size_t size, int fd) {
   assert(fd != -1, "File descriptor is not valid");
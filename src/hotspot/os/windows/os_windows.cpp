@@ -3796,11 +3796,13 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) { }
+size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) { return page_size; }
 void os::numa_make_global(char *addr, size_t bytes)    { }
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint)    { }
 bool os::numa_topology_changed()                       { return false; }
 size_t os::numa_get_groups_num()                       { return MAX2(numa_node_list_holder.get_count(), 1); }
 int os::numa_get_group_id()                            { return 0; }
+bool os::numa_bind_current_thread(int lgrp_id)         { return false; }
 size_t os::numa_get_leaf_groups(uint *ids, size_t size) {
   if (numa_node_list_holder.get_count() == 0 && size > 0) {
     // Provide an answer for UMA systems
@@ -5170,6 +5172,16 @@ char* os::pd_remap_memory(int fd, const char* file_name, size_t file_offset,
 }
 
 
+void os::prefetch_memory(char *addr, size_t bytes) {
+  // Not implemented. The pages are read in when they are first accessed.
+}
+
+bool os::page_fault_counts(jlong* minor_faults, jlong* major_faults) {
+  // Not implemented.
+  return false;
+}
+
+
 // Unmap a block of memory.
 // Returns true=success, otherwise false.
 
@@ -26,6 +26,7 @@
 #include "cds/archiveBuilder.hpp"
 #include "cds/archiveHeapWriter.hpp"
 #include "cds/archiveUtils.hpp"
+#include "cds/cdsConfig.hpp"
 #include "cds/cppVtables.hpp"
 #include "cds/dumpAllocStats.hpp"
 #include "cds/dynamicArchive.hpp"
@@ -37,21 +38,26 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/compressedKlass.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
@@ -167,6 +173,7 @@ ArchiveBuilder::ArchiveBuilder() :
 {
   _klasses = new (mtClassShared) GrowableArray<Klass*>(4 * K, mtClassShared);
   _symbols = new (mtClassShared) GrowableArray<Symbol*>(256 * K, mtClassShared);
+  _num_hot_klasses = 0;
 
   assert(_current == nullptr, "must be");
   _current = this;
@@ -285,9 +292,41 @@ int ArchiveBuilder::compare_klass_by_name(Klass** a, Klass** b) {
   return a[0]->name()->fast_compare(b[0]->name());
 }
 
+static int class_init_order(Klass* k) {
+  return k->is_instance_klass() ? SystemDictionaryShared::class_init_order(InstanceKlass::cast(k)) : -1;
+}
+
+// The classes that were initialized during the training run (see ClassListParser::record_class_init())
+// come first, in the order of their initialization, followed by all other classes sorted by name.
+int ArchiveBuilder::compare_klass_by_init_order(Klass** a, Klass** b) {
+  int order_a = class_init_order(a[0]);
+  int order_b = class_init_order(b[0]);
+  if (order_a != order_b) {
+    if (order_a < 0) {
+      return 1;
+    } else if (order_b < 0) {
+      return -1;
+    } else {
+      return order_a - order_b;
+    }
+  }
+  return compare_klass_by_name(a, b);
+}
+
 void ArchiveBuilder::sort_klasses() {
   log_info(cds)("Sorting classes ... ");
-  _klasses->sort(compare_klass_by_name);
+  _klasses->sort(compare_klass_by_init_order);
+
+  // The objects reachable from the hot classes are gathered first, so they are
+  // copied contiguously to the bottom of the rw and ro regions. This reduces the number
+  // of pages touched during start-up. See iterate_sorted_roots().
+  _num_hot_klasses = 0;
+  while (_num_hot_klasses < _klasses->length() && class_init_order(_klasses->at(_num_hot_klasses)) >= 0) {
+    _num_hot_klasses++;
+  }
+  if (_num_hot_klasses > 0) {
+    log_info(cds)("Laying out %d classes in initialization order", _num_hot_klasses);
+  }
 }
 
 size_t ArchiveBuilder::estimate_archive_size() {
@@ -380,13 +419,17 @@ address ArchiveBuilder::reserve_buffer() {
 }
 
 void ArchiveBuilder::iterate_sorted_roots(MetaspaceClosure* it) {
+  for (int i = 0; i < _num_hot_klasses; i++) {
+    it->push(_klasses->adr_at(i));
+  }
+
   int num_symbols = _symbols->length();
   for (int i = 0; i < num_symbols; i++) {
     it->push(_symbols->adr_at(i));
   }
 
   int num_klasses = _klasses->length();
-  for (int i = 0; i < num_klasses; i++) {
+  for (int i = _num_hot_klasses; i < num_klasses; i++) {
     it->push(_klasses->adr_at(i));
   }
 
@@ -530,9 +573,10 @@ ArchiveBuilder::FollowMode ArchiveBuilder::get_follow_mode(MetaspaceClosure::Ref
   if (MetaspaceShared::is_in_shared_metaspace(obj)) {
     // Don't dump existing shared metadata again.
     return point_to_it;
-  } else if (ref->msotype() == MetaspaceObj::MethodDataType ||
-             ref->msotype() == MetaspaceObj::MethodCountersType) {
+  } else if (ref->msotype() == MetaspaceObj::MethodDataType) {
     return set_to_null;
+  } else if (ref->msotype() == MetaspaceObj::MethodCountersType) {
+    return CDSConfig::is_dumping_method_counters() ? make_a_copy : set_to_null;
   } else {
     if (ref->msotype() == MetaspaceObj::ClassType) {
       Klass* klass = (Klass*)ref->obj();
@@ -700,9 +744,50 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
+// Relocating the pointers of one object only writes into the buffered copy of this
+// object and reads the _src_obj_table, which is not modified during this phase. So
+// the objects can be relocated by several workers in any order, and the archive is
+// the same as if they had been relocated serially.
+class ArchiveBuilder::RelocateEmbeddedPointersTask : public WorkerTask {
+  static const int ChunkSize = 1024;
+  ArchiveBuilder* _builder;
+  SourceObjList* _src_objs;
+  volatile int _claimed;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, SourceObjList* src_objs) :
+    WorkerTask("CDS Relocate Embedded Pointers"),
+    _builder(builder), _src_objs(src_objs), _claimed(0) {}
+
+  static int chunk_size() { return ChunkSize; }
+
+  void work(uint worker_id) {
+    int len = _src_objs->objs()->length();
+    for (;;) {
+      int start = Atomic::fetch_then_add(&_claimed, ChunkSize);
+      if (start >= len) {
+        break;
+      }
+      int end = MIN2(start + ChunkSize, len);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder);
+      }
+    }
+  }
+};
+
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && workers->active_workers() > 1 &&
+      src_objs->objs()->length() > RelocateEmbeddedPointersTask::chunk_size()) {
+    assert(SafepointSynchronize::is_at_safepoint(), "safepoint_workers() can only be used at a safepoint");
+    ArchivePtrMarker::prepare_for_parallel_marking();
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+  } else {
+    for (int i = 0; i < src_objs->objs()->length(); i++) {
+      src_objs->relocate(i, this);
+    }
   }
 }
 
@@ -195,6 +195,7 @@ class ArchiveBuilder : public StackObj {
   };
 
   class CDSMapLogger;
+  class RelocateEmbeddedPointersTask;
 
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
@@ -212,6 +213,8 @@ class ArchiveBuilder : public StackObj {
   ResizeableResourceHashtable<address, address, AnyObj::C_HEAP, mtClassShared> _buffered_to_src_table;
   GrowableArray<Klass*>* _klasses;
   GrowableArray<Symbol*>* _symbols;
+  int _num_hot_klasses;                       // the first _num_hot_klasses of _klasses were initialized
+                                              // during the training run (see sort_klasses())
 
   // statistics
   DumpAllocStats _alloc_stats;
@@ -244,6 +247,7 @@ class ArchiveBuilder : public StackObj {
   void sort_klasses();
   static int compare_symbols_by_address(Symbol** a, Symbol** b);
   static int compare_klass_by_name(Klass** a, Klass** b);
+  static int compare_klass_by_init_order(Klass** a, Klass** b);
 
   void make_shallow_copies(DumpRegion *dump_region, const SourceObjList* src_objs);
   void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/archiveHeapLoader.inline.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoaderDataShared.hpp"
@@ -33,13 +34,18 @@
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/init.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/growableArray.hpp"
 
 #if INCLUDE_CDS_JAVA_HEAP
 
 bool ArchiveHeapLoader::_is_mapped = false;
 bool ArchiveHeapLoader::_is_loaded = false;
+bool ArchiveHeapLoader::_is_streamed = false;
 
 bool    ArchiveHeapLoader::_narrow_oop_base_initialized = false;
 address ArchiveHeapLoader::_narrow_oop_base;
@@ -53,6 +59,11 @@ uintptr_t ArchiveHeapLoader::_dumptime_top = 0;
 intx ArchiveHeapLoader::_runtime_offset = 0;
 bool ArchiveHeapLoader::_loading_failed = false;
 
+// Support for streamed heap.
+char*     ArchiveHeapLoader::_streamed_buffer = nullptr;
+uintptr_t ArchiveHeapLoader::_streamed_dumptime_base = 0;
+oop       ArchiveHeapLoader::_streamed_heap_roots = nullptr;
+
 // Support for mapped heap.
 uintptr_t ArchiveHeapLoader::_mapped_heap_bottom = 0;
 bool      ArchiveHeapLoader::_mapped_heap_relocation_initialized = false;
@@ -80,6 +91,7 @@ void ArchiveHeapLoader::init_narrow_oop_decoding(address base, int shift) {
 }
 
 void ArchiveHeapLoader::fixup_region() {
+  CDSStatistics::PhaseTimer phase_timer(CDSStatistics::fixup_heap);
   FileMapInfo* mapinfo = FileMapInfo::current_info();
   if (is_mapped()) {
     mapinfo->fixup_mapped_heap_region();
@@ -224,37 +236,45 @@ void ArchiveHeapLoader::init_loaded_heap_relocation(LoadedArchiveHeapRegion* loa
 }
 
 bool ArchiveHeapLoader::can_load() {
-  if (!UseCompressedOops) {
-    // Pointer relocation for uncompressed oops is unimplemented.
-    return false;
-  }
   return Universe::heap()->can_load_archived_objects();
 }
 
 class ArchiveHeapLoader::PatchLoadedRegionPointers: public BitMapClosure {
-  narrowOop* _start;
+  address _start;
   intx _offset;
   uintptr_t _base;
   uintptr_t _top;
 
  public:
-  PatchLoadedRegionPointers(narrowOop* start, LoadedArchiveHeapRegion* loaded_region)
+  PatchLoadedRegionPointers(address start, LoadedArchiveHeapRegion* loaded_region)
     : _start(start),
       _offset(loaded_region->_runtime_offset),
       _base(loaded_region->_dumptime_base),
       _top(loaded_region->top()) {}
 
   bool do_bit(size_t offset) {
-    assert(UseCompressedOops, "PatchLoadedRegionPointers for uncompressed oops is unimplemented");
-    narrowOop* p = _start + offset;
-    narrowOop v = *p;
-    assert(!CompressedOops::is_null(v), "null oops should have been filtered out at dump time");
-    uintptr_t o = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(v));
-    assert(_base <= o && o < _top, "must be");
-
-    o += _offset;
-    ArchiveHeapLoader::assert_in_loaded_heap(o);
-    RawAccess<IS_NOT_NULL>::oop_store(p, cast_to_oop(o));
+    if (UseCompressedOops) {
+      narrowOop* p = (narrowOop*)_start + offset;
+      narrowOop v = *p;
+      assert(!CompressedOops::is_null(v), "null oops should have been filtered out at dump time");
+      uintptr_t o = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(v));
+      assert(_base <= o && o < _top, "must be");
+
+      o += _offset;
+      ArchiveHeapLoader::assert_in_loaded_heap(o);
+      RawAccess<IS_NOT_NULL>::oop_store(p, cast_to_oop(o));
+    } else {
+      // The uncompressed oops were written as their dumptime (requested) addresses,
+      // which all fall inside [_base, _top). See ArchiveHeapWriter::set_requested_address().
+      oop* p = (oop*)_start + offset;
+      uintptr_t o = (uintptr_t)((void*)*p);
+      assert(o != 0, "null oops should have been filtered out at dump time");
+      assert(_base <= o && o < _top, "must be");
+
+      o += _offset;
+      ArchiveHeapLoader::assert_in_loaded_heap(o);
+      RawAccess<IS_NOT_NULL>::oop_store(p, cast_to_oop(o));
+    }
     return true;
   }
 };
@@ -315,14 +335,15 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
   uintptr_t oopmap = bitmap_base + r->oopmap_offset();
   BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
 
-  PatchLoadedRegionPointers patcher((narrowOop*)load_address, loaded_region);
+  PatchLoadedRegionPointers patcher((address)load_address, loaded_region);
   bm.iterate(&patcher);
   return true;
 }
 
 bool ArchiveHeapLoader::load_heap_region(FileMapInfo* mapinfo) {
-  assert(UseCompressedOops, "loaded heap for !UseCompressedOops is unimplemented");
-  init_narrow_oop_decoding(mapinfo->narrow_oop_base(), mapinfo->narrow_oop_shift());
+  if (UseCompressedOops) {
+    init_narrow_oop_decoding(mapinfo->narrow_oop_base(), mapinfo->narrow_oop_shift());
+  }
 
   LoadedArchiveHeapRegion loaded_region;
   memset(&loaded_region, 0, sizeof(loaded_region));
@@ -343,26 +364,254 @@ bool ArchiveHeapLoader::load_heap_region(FileMapInfo* mapinfo) {
   return true;
 }
 
+// ------------------ Support for Region STREAMING ---------------------------------------
+
+// The objects are read into a temporary buffer, and each of them is copied into the heap
+// with a regular allocation request. Hence the collector doesn't need to provide a
+// contiguous block of memory for the whole region (as with can_load()), and the
+// embedded pointers are stored with the GC barriers, so this works with any collector,
+// including the ones that color their pointers or require a specific heap layout.
+//
+// Streaming is done in two steps:
+// - stream_heap_region() reads the region into _streamed_buffer when the archive is mapped.
+// - materialize_streamed_heap() allocates the objects. This must be done after the
+//   archived offsets of the well-known classes (e.g., java_lang_Class::oop_size())
+//   have been restored by MetaspaceShared::serialize(), as these are needed to
+//   compute the size of the buffered objects.
+//
+// Both steps happen before VM initialization has completed, so no GC can happen
+// and the raw oops of the materialized objects can be held in C heap arrays.
+//
+// For the same reason, the collectors cannot recover from an allocation failure
+// during materialization (they exit the VM instead of starting a GC). Streaming is
+// skipped if the region would take a large part of the heap, and archived objects
+// are disabled, as when the region cannot be mapped or loaded.
+
+bool ArchiveHeapLoader::can_stream() {
+  return UseCompressedClassPointers;
+}
+
+bool ArchiveHeapLoader::stream_heap_region(FileMapInfo* mapinfo) {
+  FileMapRegion* r = mapinfo->region_at(MetaspaceShared::hp);
+  r->assert_is_heap_region();
+  if (r->used() == 0) {
+    return false;
+  }
+  size_t max_capacity = Universe::heap()->max_capacity();
+  if (r->used() > max_capacity / 4) {
+    log_info(cds)("Cannot stream heap region %d: " SIZE_FORMAT " bytes is too large for a heap of " SIZE_FORMAT
+                  " bytes. Archived objects are disabled", MetaspaceShared::hp, r->used(), max_capacity);
+    return false;
+  }
+  if (mapinfo->map_bitmap_region() == nullptr) {
+    return false; // OOM or CRC error
+  }
+  if (UseCompressedOops) {
+    init_narrow_oop_decoding(mapinfo->narrow_oop_base(), mapinfo->narrow_oop_shift());
+  }
+
+  assert(is_aligned(r->used(), HeapWordSize), "must be");
+  char* buffer = NEW_C_HEAP_ARRAY(char, r->used(), mtClassShared);
+  if (!mapinfo->read_region(MetaspaceShared::hp, buffer, r->used(), /* do_commit = */ false)) {
+    log_warning(cds)("Streaming of heap region %d has failed. Archived objects are disabled", MetaspaceShared::hp);
+    r->set_mapped_base(nullptr);
+    FREE_C_HEAP_ARRAY(char, buffer);
+    return false;
+  }
+
+  _streamed_buffer = buffer;
+  _streamed_dumptime_base = (uintptr_t)mapinfo->heap_region_dumptime_address();
+  _is_streamed = true;
+  log_info(cds)("Streamed heap  region #%d into buffer " INTPTR_FORMAT " size " SIZE_FORMAT_W(6),
+                MetaspaceShared::hp, p2i(buffer), r->used());
+  return true;
+}
+
+// An oop field inside the streamed region. Both offsets are from the bottom of the region.
+struct StreamedOopField {
+  size_t _field_offset;
+  size_t _referent_offset;
+};
+
+// A materialized object and its offset from the bottom of the streamed region.
+struct StreamedObject {
+  size_t _offset;
+  oop    _obj;
+};
+
+// Record all the non-null embedded pointers in the streamed buffer, and clear them,
+// so each object is copied into the heap with null oop fields, just like a newly
+// allocated object.
+class ArchiveHeapLoader::CollectStreamedOopFields: public BitMapClosure {
+  address _buffer;
+  uintptr_t _dumptime_base;
+  uintptr_t _dumptime_top;
+  GrowableArrayCHeap<StreamedOopField, mtClassShared>* _fields;
+
+ public:
+  CollectStreamedOopFields(address buffer, size_t size,
+                           GrowableArrayCHeap<StreamedOopField, mtClassShared>* fields)
+    : _buffer(buffer),
+      _dumptime_base(ArchiveHeapLoader::_streamed_dumptime_base),
+      _dumptime_top(ArchiveHeapLoader::_streamed_dumptime_base + size),
+      _fields(fields) {}
+
+  bool do_bit(size_t offset) {
+    StreamedOopField field;
+    uintptr_t o;
+    if (UseCompressedOops) {
+      narrowOop* p = (narrowOop*)_buffer + offset;
+      assert(!CompressedOops::is_null(*p), "null oops should have been filtered out at dump time");
+      o = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(*p));
+      *p = narrowOop::null;
+      field._field_offset = offset * sizeof(narrowOop);
+    } else {
+      oop* p = (oop*)_buffer + offset;
+      o = (uintptr_t)((void*)*p);
+      assert(o != 0, "null oops should have been filtered out at dump time");
+      *p = nullptr;
+      field._field_offset = offset * sizeof(oop);
+    }
+    assert(_dumptime_base <= o && o < _dumptime_top, "must point into the archived region");
+    field._referent_offset = o - _dumptime_base;
+    _fields->append(field);
+    return true;
+  }
+};
+
+oop ArchiveHeapLoader::allocate_streamed_object(oop buffered_obj, size_t word_size, TRAPS) {
+  Klass* k = buffered_obj->klass();
+  if (k->is_array_klass()) {
+    return Universe::heap()->array_allocate(k, word_size, arrayOop(buffered_obj)->length(),
+                                            /* do_zero */ true, THREAD);
+  } else if (k->is_mirror_instance_klass()) {
+    return Universe::heap()->class_allocate(k, word_size, THREAD);
+  } else {
+    return Universe::heap()->obj_allocate(k, word_size, THREAD);
+  }
+}
+
+static int compare_streamed_object_offset(const size_t& offset, const StreamedObject& obj) {
+  if (offset < obj._offset) {
+    return -1;
+  } else if (offset > obj._offset) {
+    return 1;
+  }
+  return 0;
+}
+
+static oop streamed_object_at(GrowableArrayCHeap<StreamedObject, mtClassShared>* objects, size_t offset) {
+  bool found;
+  int i = objects->find_sorted<size_t, compare_streamed_object_offset>(offset, found);
+  assert(found, "must point to the beginning of an archived object");
+  return objects->at(i)._obj;
+}
+
+bool ArchiveHeapLoader::materialize_streamed_heap() {
+  assert(is_streamed(), "must be");
+  assert(!is_init_completed(), "no GC can happen while the raw oops are held");
+
+  FileMapInfo* mapinfo = FileMapInfo::current_info();
+  FileMapRegion* r = mapinfo->region_at(MetaspaceShared::hp);
+  size_t size = r->used();
+  address buffer = (address)_streamed_buffer;
+
+  GrowableArrayCHeap<StreamedOopField, mtClassShared> fields(10000);
+  {
+    address oopmap = (address)mapinfo->map_bitmap_region() + r->oopmap_offset();
+    BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
+    CollectStreamedOopFields collector(buffer, size, &fields);
+    bm.iterate(&collector);
+  }
+
+  // Copy the objects in the order of their offsets, so that <objects> is sorted.
+  GrowableArrayCHeap<StreamedObject, mtClassShared> objects(10000);
+  JavaThread* THREAD = JavaThread::current();
+  for (size_t offset = 0; offset < size; ) {
+    oop buffered_obj = cast_to_oop(buffer + offset);
+    size_t word_size = buffered_obj->size();
+    oop obj = allocate_streamed_object(buffered_obj, word_size, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      // The objects copied so far are unreachable, and their oop fields have been
+      // cleared, so they will be collected like any other garbage.
+      log_warning(cds)("Cannot allocate the streamed heap objects (" SIZE_FORMAT " of " SIZE_FORMAT " bytes copied). "
+                       "Archived objects are disabled", offset, size);
+      disable_streamed_heap();
+      return false;
+    }
+    Copy::disjoint_words((HeapWord*)buffered_obj, cast_from_oop<HeapWord*>(obj), word_size);
+
+    StreamedObject so;
+    so._offset = offset;
+    so._obj = obj;
+    objects.append(so);
+    offset += word_size * HeapWordSize;
+  }
+
+  // All the objects exist now; store the embedded pointers. The fields were collected
+  // in increasing order of their offsets, so we can find the enclosing objects by
+  // walking <objects> in the same direction.
+  int cur = 0;
+  for (int i = 0; i < fields.length(); i++) {
+    StreamedOopField field = fields.at(i);
+    while (cur + 1 < objects.length() && objects.at(cur + 1)._offset <= field._field_offset) {
+      cur++;
+    }
+    oop obj = objects.at(cur)._obj;
+    ptrdiff_t field_offset_in_obj = (ptrdiff_t)(field._field_offset - objects.at(cur)._offset);
+    oop referent = streamed_object_at(&objects, field._referent_offset);
+    if (obj->is_objArray()) {
+      HeapAccess<IS_ARRAY>::oop_store_at(obj, field_offset_in_obj, referent);
+    } else {
+      HeapAccess<>::oop_store_at(obj, field_offset_in_obj, referent);
+    }
+  }
+
+  _streamed_heap_roots = streamed_object_at(&objects, mapinfo->heap_roots_offset());
+  log_info(cds)("Materialized %d streamed heap objects with %d embedded pointers", objects.length(), fields.length());
+
+  r->set_mapped_base(nullptr);
+  FREE_C_HEAP_ARRAY(char, _streamed_buffer);
+  _streamed_buffer = nullptr;
+  return true;
+}
+
+void ArchiveHeapLoader::disable_streamed_heap() {
+  assert(is_streamed(), "must be");
+  FileMapInfo::current_info()->region_at(MetaspaceShared::hp)->set_mapped_base(nullptr);
+  FREE_C_HEAP_ARRAY(char, _streamed_buffer);
+  _streamed_buffer = nullptr;
+  _is_streamed = false;
+  MetaspaceShared::disable_full_module_graph();
+}
+
 class VerifyLoadedHeapEmbeddedPointers: public BasicOopIterateClosure {
   ResourceHashtable<uintptr_t, bool>* _table;
 
  public:
   VerifyLoadedHeapEmbeddedPointers(ResourceHashtable<uintptr_t, bool>* table) : _table(table) {}
 
+  // This should be called before the loaded region is modified, so all the embedded pointers
+  // must be null, or must point to a valid object in the loaded region.
   virtual void do_oop(narrowOop* p) {
-    // This should be called before the loaded region is modified, so all the embedded pointers
-    // must be null, or must point to a valid object in the loaded region.
     narrowOop v = *p;
     if (!CompressedOops::is_null(v)) {
-      oop o = CompressedOops::decode_not_null(v);
-      uintptr_t u = cast_from_oop<uintptr_t>(o);
-      ArchiveHeapLoader::assert_in_loaded_heap(u);
-      guarantee(_table->contains(u), "must point to beginning of object in loaded archived region");
+      verify(CompressedOops::decode_not_null(v));
     }
   }
   virtual void do_oop(oop* p) {
-    // Uncompressed oops are not supported by loaded heaps.
-    Unimplemented();
+    oop o = RawAccess<>::oop_load(p);
+    if (o != nullptr) {
+      verify(o);
+    }
+  }
+
+ private:
+  void verify(oop o) {
+    uintptr_t u = cast_from_oop<uintptr_t>(o);
+    ArchiveHeapLoader::assert_in_loaded_heap(u);
+    guarantee(_table->contains(u), "must point to beginning of object in loaded archived region");
   }
 };
 
@@ -374,7 +623,15 @@ void ArchiveHeapLoader::finish_initialization() {
       verify_loaded_heap();
     }
   }
-  if (is_in_use()) {
+  if (is_streamed()) {
+    // The native pointers are patched inside _streamed_buffer, before the objects
+    // are copied into the heap.
+    patch_native_pointers();
+    if (materialize_streamed_heap()) {
+      HeapShared::init_roots(_streamed_heap_roots);
+      _streamed_heap_roots = nullptr;
+    }
+  } else if (is_in_use()) {
     patch_native_pointers();
     intptr_t bottom = is_loaded() ? _loaded_heap_bottom : _mapped_heap_bottom;
     intptr_t roots_oop = bottom + FileMapInfo::current_info()->heap_roots_offset();
@@ -447,6 +704,8 @@ void ArchiveHeapLoader::patch_native_pointers() {
   FileMapRegion* r = FileMapInfo::current_info()->region_at(MetaspaceShared::hp);
   if (r->mapped_base() != nullptr && r->has_ptrmap()) {
     log_info(cds, heap)("Patching native pointers in heap region");
+    CDSStatistics::PhaseTimer phase_timer(CDSStatistics::patch_native_pointers);
+    phase_timer.add_bytes(r->used());
     BitMapView bm = r->ptrmap_view();
     PatchNativePointers patcher((Metadata**)r->mapped_base());
     bm.iterate(&patcher);
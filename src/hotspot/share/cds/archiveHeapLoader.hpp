@@ -33,6 +33,7 @@
 #include "oops/oopsHierarchy.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/bitMap.hpp"
+#include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
 
 class  FileMapInfo;
@@ -46,7 +47,11 @@ class ArchiveHeapLoader : AllStatic {
   // - Loaded: At VM start-up, the objects in the heap region are copied into the
   //           Java heap. This is easier to implement than mapping but
   //           slightly less efficient, as the embedded pointers need to be relocated.
-  static bool can_use() { return can_map() || can_load(); }
+  // - Streamed: (any GC) At VM start-up, each object in the heap region is materialized
+  //           with a regular heap allocation, and the embedded pointers are stored with
+  //           the GC barriers. This is the slowest mode, but the GC doesn't need to
+  //           provide any special support for the archived heap.
+  static bool can_use() { return can_map() || can_load() || can_stream(); }
 
   // Can this VM map archived heap region? Currently only G1+compressed{oops,cp}
   static bool can_map() {
@@ -56,14 +61,23 @@ class ArchiveHeapLoader : AllStatic {
 
   // Can this VM load the objects from archived heap region into the heap at start-up?
   static bool can_load()  NOT_CDS_JAVA_HEAP_RETURN_(false);
+
+  // Can this VM materialize the objects from archived heap region one at a time at start-up?
+  static bool can_stream() NOT_CDS_JAVA_HEAP_RETURN_(false);
+
   static void finish_initialization() NOT_CDS_JAVA_HEAP_RETURN;
   static bool is_loaded() {
     CDS_JAVA_HEAP_ONLY(return _is_loaded;)
     NOT_CDS_JAVA_HEAP(return false;)
   }
 
+  static bool is_streamed() {
+    CDS_JAVA_HEAP_ONLY(return _is_streamed;)
+    NOT_CDS_JAVA_HEAP(return false;)
+  }
+
   static bool is_in_use() {
-    return is_loaded() || is_mapped();
+    return is_loaded() || is_mapped() || is_streamed();
   }
 
   static ptrdiff_t mapped_heap_delta() {
@@ -106,6 +120,7 @@ class ArchiveHeapLoader : AllStatic {
 private:
   static bool _is_mapped;
   static bool _is_loaded;
+  static bool _is_streamed;
 
   // Support for loaded archived heap. These are cached values from
   // LoadedArchiveHeapRegion's.
@@ -117,6 +132,12 @@ class ArchiveHeapLoader : AllStatic {
   static uintptr_t _loaded_heap_top;
   static bool _loading_failed;
 
+  // is_streamed() only: the archived objects are read into _streamed_buffer when the
+  // archive is mapped, and are materialized in the heap by finish_initialization().
+  static char*     _streamed_buffer;
+  static uintptr_t _streamed_dumptime_base;
+  static oop       _streamed_heap_roots;
+
   // UseCompressedOops only: Used by decode_from_archive
   static bool    _narrow_oop_base_initialized;
   static address _narrow_oop_base;
@@ -137,6 +158,9 @@ class ArchiveHeapLoader : AllStatic {
   static void finish_loaded_heap();
   static void verify_loaded_heap();
   static void fill_failed_loaded_heap();
+  static bool materialize_streamed_heap();
+  static void disable_streamed_heap();
+  static oop allocate_streamed_object(oop buffered_obj, size_t word_size, TRAPS);
 
   static bool is_in_loaded_heap(uintptr_t o) {
     return (_loaded_heap_bottom <= o && o < _loaded_heap_top);
@@ -146,10 +170,12 @@ class ArchiveHeapLoader : AllStatic {
   inline static oop decode_from_archive_impl(narrowOop v) NOT_CDS_JAVA_HEAP_RETURN_(nullptr);
 
   class PatchLoadedRegionPointers;
+  class CollectStreamedOopFields;
 
 public:
 
   static bool load_heap_region(FileMapInfo* mapinfo);
+  static bool stream_heap_region(FileMapInfo* mapinfo);
   static void assert_in_loaded_heap(uintptr_t o) {
     assert(is_in_loaded_heap(o), "must be");
   }
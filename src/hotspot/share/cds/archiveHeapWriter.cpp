@@ -85,8 +85,11 @@ void ArchiveHeapWriter::init() {
     _native_pointers = new GrowableArrayCHeap<NativePointerInfo, mtClassShared>(2048);
     _source_objs = new GrowableArrayCHeap<oop, mtClassShared>(10000);
 
-    guarantee(UseG1GC, "implementation limitation");
-    guarantee(MIN_GC_REGION_ALIGNMENT <= /*G1*/HeapRegion::min_region_size_in_words() * HeapWordSize, "must be");
+#if INCLUDE_G1GC
+    if (UseG1GC) {
+      guarantee(MIN_GC_REGION_ALIGNMENT <= /*G1*/HeapRegion::min_region_size_in_words() * HeapWordSize, "must be");
+    }
+#endif
   }
 }
 
@@ -226,11 +229,68 @@ void ArchiveHeapWriter::copy_roots_to_buffer(GrowableArrayCHeap<oop, mtClassShar
   _buffer_used = new_used;
 }
 
+// The value array of a String is never handed out by java.lang.String, so its
+// identity cannot be observed. Archived strings with equal contents but distinct
+// identities can therefore share a single buffered copy of their value array.
+static unsigned string_value_hash(typeArrayOop const& value) {
+  int len = value->length();
+  return len == 0 ? 0 : java_lang_String::hash_code(value->byte_at_addr(0), len);
+}
+
+static bool string_value_equals(typeArrayOop const& a, typeArrayOop const& b) {
+  int len = a->length();
+  return len == b->length() &&
+         (len == 0 || memcmp(a->byte_at_addr(0), b->byte_at_addr(0), len) == 0);
+}
+
+typedef ResourceHashtable<oop, bool,
+      15889, // prime number
+      AnyObj::C_HEAP,
+      mtClassShared,
+      HeapShared::oop_hash> StringValueSet;
+
+typedef ResourceHashtable<typeArrayOop, size_t,
+      15889, // prime number
+      AnyObj::C_HEAP,
+      mtClassShared,
+      string_value_hash,
+      string_value_equals> StringValueToBufferOffsetTable;
+
 void ArchiveHeapWriter::copy_source_objs_to_buffer(GrowableArrayCHeap<oop, mtClassShared>* roots) {
+  StringValueSet string_values;
+  for (int i = 0; i < _source_objs->length(); i++) {
+    oop src_obj = _source_objs->at(i);
+    if (java_lang_String::is_instance(src_obj)) {
+      typeArrayOop value = java_lang_String::value_no_keepalive(src_obj);
+      if (value != nullptr) {
+        string_values.put(value, true);
+      }
+    }
+  }
+
+  StringValueToBufferOffsetTable copied_string_values;
+  int num_shared_values = 0;
+  size_t shared_values_bytes = 0;
   for (int i = 0; i < _source_objs->length(); i++) {
     oop src_obj = _source_objs->at(i);
     HeapShared::CachedOopInfo* info = HeapShared::archived_object_cache()->get(src_obj);
     assert(info != nullptr, "must be");
+    if (string_values.contains(src_obj)) {
+      typeArrayOop value = (typeArrayOop)src_obj;
+      size_t* copied_offset = copied_string_values.get(value);
+      if (copied_offset != nullptr) {
+        // Share the value array copied for an earlier string with the same contents.
+        info->set_buffer_offset(*copied_offset);
+        num_shared_values++;
+        shared_values_bytes += src_obj->size() * HeapWordSize;
+        continue;
+      }
+      size_t buffer_offset = copy_one_source_obj_to_buffer(src_obj);
+      info->set_buffer_offset(buffer_offset);
+      _buffer_offset_to_source_obj_table->put(buffer_offset, src_obj);
+      copied_string_values.put(value, buffer_offset);
+      continue;
+    }
     size_t buffer_offset = copy_one_source_obj_to_buffer(src_obj);
     info->set_buffer_offset(buffer_offset);
 
@@ -240,7 +300,9 @@ void ArchiveHeapWriter::copy_source_objs_to_buffer(GrowableArrayCHeap<oop, mtCla
   copy_roots_to_buffer(roots);
 
   log_info(cds)("Size of heap region = " SIZE_FORMAT " bytes, %d objects, %d roots",
-                _buffer_used, _source_objs->length() + 1, roots->length());
+                _buffer_used, _source_objs->length() - num_shared_values + 1, roots->length());
+  log_info(cds)("Shared %d duplicate String value arrays (" SIZE_FORMAT " bytes)",
+                num_shared_values, shared_values_bytes);
 }
 
 size_t ArchiveHeapWriter::filler_array_byte_size(int length) {
@@ -372,16 +434,24 @@ size_t ArchiveHeapWriter::copy_one_source_obj_to_buffer(oop src_obj) {
 
 void ArchiveHeapWriter::set_requested_address(ArchiveHeapInfo* info) {
   assert(!info->is_used(), "only set once");
-  assert(UseG1GC, "must be");
-  address heap_end = (address)G1CollectedHeap::heap()->reserved().end();
-  log_info(cds, heap)("Heap end = %p", heap_end);
 
   size_t heap_region_byte_size = _buffer_used;
   assert(heap_region_byte_size > 0, "must archived at least one object!");
 
+  // Objects are placed at the top of the heap, so that G1 can map them into its
+  // highest regions. Other collectors never map the region and always relocate, but
+  // use the same layout so the archive contents don't depend on the dumping GC.
+  size_t alignment = MIN_GC_REGION_ALIGNMENT;
+#if INCLUDE_G1GC
+  if (UseG1GC) {
+    alignment = HeapRegion::GrainBytes;
+  }
+#endif
 
   if (UseCompressedOops) {
-    _requested_bottom = align_down(heap_end - heap_region_byte_size, HeapRegion::GrainBytes);
+    address heap_end = (address)CompressedOops::end();
+    log_info(cds, heap)("Heap end = %p", heap_end);
+    _requested_bottom = align_down(heap_end - heap_region_byte_size, alignment);
   } else {
     // We always write the objects as if the heap started at this address. This
     // makes the contents of the archive heap deterministic.
@@ -391,7 +461,7 @@ void ArchiveHeapWriter::set_requested_address(ArchiveHeapInfo* info) {
     _requested_bottom = (address)NOCOOPS_REQUESTED_BASE;
   }
 
-  assert(is_aligned(_requested_bottom, HeapRegion::GrainBytes), "sanity");
+  assert(is_aligned(_requested_bottom, alignment), "sanity");
 
   _requested_top = _requested_bottom + _buffer_used;
 
@@ -520,6 +590,11 @@ void ArchiveHeapWriter::relocate_embedded_oops(GrowableArrayCHeap<oop, mtClassSh
   heap_info->oopmap()->resize(heap_region_byte_size   / oopmap_unit);
 
   auto iterator = [&] (oop src_obj, HeapShared::CachedOopInfo& info) {
+    if (*_buffer_offset_to_source_obj_table->get(info.buffer_offset()) != src_obj) {
+      // A String value array that shares the buffered copy of an equal array.
+      // It has no embedded oops, and the header belongs to the copied array.
+      return;
+    }
     oop requested_obj = requested_obj_from_buffer_offset(info.buffer_offset());
     update_header_for_requested_obj(requested_obj, src_obj, src_obj->klass());
     address buffered_obj = offset_to_buffered_address<address>(info.buffer_offset());
@@ -96,8 +96,8 @@ class ArchiveHeapWriter : AllStatic {
   //
   //   At dump time, we assume that the runtime heap range is exactly the same as
   //   in dump time. The requested addresses of the archived objects are chosen such that
-  //   they would occupy the top end of a G1 heap (TBD when dumping is supported by other
-  //   collectors. See JDK-8298614).
+  //   they would occupy the top end of a G1 heap. This is also done when dumping with
+  //   other collectors, so the contents of the archive don't depend on the dumping GC.
   //
   // UseCompressedOops == false:
   //   At runtime, the heap range is usually picked (randomly) by the OS, so we will almost always
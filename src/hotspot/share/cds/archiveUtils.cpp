@@ -40,10 +40,13 @@
 #include "memory/resourceArea.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 CHeapBitMap* ArchivePtrMarker::_ptrmap = nullptr;
 VirtualSpace* ArchivePtrMarker::_vs;
@@ -86,12 +89,23 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
         _ptrmap->resize((idx + 1) * 2);
       }
       assert(idx < _ptrmap->size(), "must be");
-      _ptrmap->set_bit(idx);
+      _ptrmap->par_set_bit(idx);
       //tty->print_cr("Marking pointer [" PTR_FORMAT "] -> " PTR_FORMAT " @ " SIZE_FORMAT_W(5), p2i(ptr_loc), p2i(*ptr_loc), idx);
     }
   }
 }
 
+// Grow the bitmap to cover all the committed buffer space up front, so that
+// mark_pointer() does not need to resize it when called by several threads.
+void ArchivePtrMarker::prepare_for_parallel_marking() {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t size = ptr_end() - ptr_base();
+  if (_ptrmap->size() < size) {
+    _ptrmap->resize(size);
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != nullptr, "not initialized");
   assert(!_compacted, "cannot clear anymore");
@@ -352,3 +366,80 @@ void ArchiveUtils::log_to_classlist(BootstrapInfo* bootstrap_specifier, TRAPS) {
     }
   }
 }
+
+void ArchiveWorkerTask::configure_max_chunks(int max_chunks) {
+  assert(_max_chunks == 0, "configure only once");
+  _max_chunks = max_chunks;
+}
+
+void ArchiveWorkerTask::run() {
+  while (true) {
+    int chunk = Atomic::fetch_then_add(&_chunk, 1);
+    if (chunk >= _max_chunks) {
+      return;
+    }
+    work(chunk, _max_chunks);
+  }
+}
+
+ArchiveWorkerThread::ArchiveWorkerThread(ArchiveWorkers* pool) : NamedThread(), _pool(pool) {
+  set_name("ArchiveWorkerThread");
+}
+
+void ArchiveWorkerThread::run() {
+  _pool->run_as_worker();
+}
+
+void ArchiveWorkerThread::post_run() {
+  this->NamedThread::post_run();
+  delete this;
+}
+
+ArchiveWorkers::ArchiveWorkers() :
+  _end_semaphore(0),
+  _task(nullptr),
+  _num_workers(max_workers()) {}
+
+int ArchiveWorkers::max_workers() {
+  if (!ArchiveParallelRelocation) {
+    return 0;
+  }
+  // A few threads are enough to saturate the memory bandwidth. Creating
+  // more than that only adds to startup time.
+  return MAX2(0, log2i_graceful(os::initial_active_processor_count()));
+}
+
+void ArchiveWorkers::run_as_worker() {
+  assert(_task != nullptr, "must be");
+  _task->run();
+  // Last access to this ArchiveWorkers: the caller of run_task() may return as
+  // soon as all workers have signaled.
+  _end_semaphore.signal();
+}
+
+int ArchiveWorkers::run_task(ArchiveWorkerTask* task) {
+  assert(_task == nullptr, "run only one task at a time");
+  _task = task;
+  task->configure_max_chunks(MAX2(1, _num_workers * CHUNKS_PER_WORKER));
+
+  int started = 0;
+  for (int i = 0; i < _num_workers; i++) {
+    ArchiveWorkerThread* thread = new ArchiveWorkerThread(this);
+    if (!os::create_thread(thread, os::os_thread)) {
+      // Not fatal, the remaining chunks are done by the threads we already have.
+      log_info(cds)("Failed to create ArchiveWorkerThread, using %d worker(s) for %s", started, task->name());
+      delete thread;
+      break;
+    }
+    os::start_thread(thread);
+    started++;
+  }
+
+  task->run();
+
+  for (int i = 0; i < started; i++) {
+    _end_semaphore.wait();
+  }
+  _task = nullptr;
+  return started;
+}
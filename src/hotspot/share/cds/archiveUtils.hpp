@@ -28,6 +28,8 @@
 #include "cds/serializeClosure.hpp"
 #include "logging/log.hpp"
 #include "memory/virtualspace.hpp"
+#include "runtime/nonJavaThread.hpp"
+#include "runtime/semaphore.hpp"
 #include "utilities/bitMap.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
@@ -55,6 +57,7 @@ class ArchivePtrMarker : AllStatic {
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+  static void prepare_for_parallel_marking();
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
@@ -234,4 +237,63 @@ class ArchiveUtils {
   static void log_to_classlist(BootstrapInfo* bootstrap_specifier, TRAPS) NOT_CDS_RETURN;
 };
 
+class ArchiveWorkers;
+
+// A task to be executed by the ArchiveWorkers. The work is split into max_chunks
+// chunks, which are claimed by the participating threads in any order.
+class ArchiveWorkerTask : public StackObj {
+  friend class ArchiveWorkers;
+private:
+  const char* _name;
+  int _max_chunks;
+  volatile int _chunk;
+
+  void run();
+  void configure_max_chunks(int max_chunks);
+
+public:
+  ArchiveWorkerTask(const char* name) : _name(name), _max_chunks(0), _chunk(0) {}
+  const char* name() const { return _name; }
+
+  virtual void work(int chunk, int max_chunks) = 0;
+};
+
+class ArchiveWorkerThread : public NamedThread {
+  friend class ArchiveWorkers;
+private:
+  ArchiveWorkers* const _pool;
+
+  void post_run() override;
+
+public:
+  ArchiveWorkerThread(ArchiveWorkers* pool);
+  const char* type_name() const override { return "Archive Worker Thread"; }
+  void run() override;
+};
+
+// A short-lived group of helper threads for parallelizing the work done while
+// mapping the archive at startup, before the GC worker threads can be used.
+// The helper threads are started by run_task() and terminate when the task
+// is done. The calling thread also participates in the task.
+class ArchiveWorkers : public StackObj {
+  friend class ArchiveWorkerThread;
+private:
+  static const int CHUNKS_PER_WORKER = 4;
+
+  Semaphore _end_semaphore;
+  ArchiveWorkerTask* _task;
+  int _num_workers;
+
+  void run_as_worker();
+
+public:
+  ArchiveWorkers();
+
+  // Number of threads (in addition to the caller) that may be used by run_task().
+  static int max_workers();
+
+  // Returns the number of helper threads that were started for the task.
+  int run_task(ArchiveWorkerTask* task);
+};
+
 #endif // SHARE_CDS_ARCHIVEUTILS_HPP
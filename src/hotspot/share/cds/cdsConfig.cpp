@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/cds_globals.hpp"
 #include "cds/cdsConfig.hpp"
 #include "cds/heapShared.hpp"
 
@@ -38,9 +39,19 @@ bool CDSConfig::is_dumping_dynamic_archive() {
   return DynamicDumpSharedSpaces;
 }
 
+bool CDSConfig::is_dumping_method_counters() {
+  // The static dump does not run the application, so its counters are meaningless.
+  return is_dumping_dynamic_archive() && ArchiveMethodCounters;
+}
+
 #if INCLUDE_CDS_JAVA_HEAP
 bool CDSConfig::is_dumping_heap() {
-  // heap dump is not supported in dynamic dump
+  // heap dump is not supported in dynamic dump: the ArchiveHeapLoader can map or
+  // load only a single heap region, and the objects in the static archive's region
+  // cannot point into a region of the dynamic archive (or vice versa) without a
+  // second root segment and cross-region relocation. To get archived mirrors,
+  // resolved_references and strings for app classes, include the app classes in
+  // the static archive (with -XX:SharedClassListFile and -cp at dump time).
   return is_dumping_static_archive() && HeapShared::can_write();
 }
 #endif // INCLUDE_CDS_JAVA_HEAP
@@ -35,6 +35,9 @@ class CDSConfig : public AllStatic {
   static bool      is_dumping_static_archive()               NOT_CDS_RETURN_(false);
   static bool      is_dumping_dynamic_archive()              NOT_CDS_RETURN_(false);
 
+  // Training data
+  static bool      is_dumping_method_counters()              NOT_CDS_RETURN_(false);
+
   // CDS archived heap
   static bool      is_dumping_heap()                         NOT_CDS_JAVA_HEAP_RETURN_(false);
 };
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "cds/cds_globals.hpp"
+#include "cds/cdsStatistics.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "runtime/perfData.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/ostream.hpp"
+
+jlong CDSStatistics::_ticks[CDSStatistics::num_phases];
+jlong CDSStatistics::_bytes[CDSStatistics::num_phases];
+jlong CDSStatistics::_count[CDSStatistics::num_phases];
+jlong CDSStatistics::_minor_faults[CDSStatistics::num_phases];
+jlong CDSStatistics::_major_faults[CDSStatistics::num_phases];
+
+PerfCounter* CDSStatistics::_perf_ticks[CDSStatistics::num_phases];
+PerfCounter* CDSStatistics::_perf_bytes[CDSStatistics::num_phases];
+PerfCounter* CDSStatistics::_perf_faults[CDSStatistics::num_phases];
+
+static const char* _phase_names[] = {
+  "mapRegions",
+  "relocate",
+  "mapHeap",
+  "fixupHeap",
+  "patchNativePointers",
+  "initSubgraphs",
+  "restoreClasses"
+};
+
+const char* CDSStatistics::phase_name(Phase phase) {
+  STATIC_ASSERT(ARRAY_SIZE(_phase_names) == num_phases);
+  assert(phase >= 0 && phase < num_phases, "sanity");
+  return _phase_names[phase];
+}
+
+void CDSStatistics::initialize() {
+  if (!RecordCDSStatistics || !UsePerfData) {
+    return;
+  }
+  EXCEPTION_MARK;
+  for (int i = 0; i < num_phases; i++) {
+    const char* name = phase_name((Phase)i);
+    char counter_name[64];
+    os::snprintf_checked(counter_name, sizeof(counter_name), "cds.%sTime", name);
+    _perf_ticks[i] = PerfDataManager::create_counter(SUN_CLS, counter_name, PerfData::U_Ticks, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      break;
+    }
+    os::snprintf_checked(counter_name, sizeof(counter_name), "cds.%sBytes", name);
+    _perf_bytes[i] = PerfDataManager::create_counter(SUN_CLS, counter_name, PerfData::U_Bytes, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      break;
+    }
+    os::snprintf_checked(counter_name, sizeof(counter_name), "cds.%sPageFaults", name);
+    _perf_faults[i] = PerfDataManager::create_counter(SUN_CLS, counter_name, PerfData::U_Events, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      break;
+    }
+  }
+  if (HAS_PENDING_EXCEPTION) {
+    vm_exit_during_initialization("CDSStatistics::initialize() failed unexpectedly");
+  }
+}
+
+void CDSStatistics::record(Phase phase, jlong ticks, jlong bytes, jlong minor_faults, jlong major_faults) {
+  Atomic::add(&_ticks[phase], ticks);
+  Atomic::add(&_bytes[phase], bytes);
+  Atomic::add(&_count[phase], (jlong)1);
+  Atomic::add(&_minor_faults[phase], minor_faults);
+  Atomic::add(&_major_faults[phase], major_faults);
+
+  if (_perf_ticks[phase] != nullptr) {
+    _perf_ticks[phase]->inc(ticks);
+    _perf_bytes[phase]->inc(bytes);
+    _perf_faults[phase]->inc(minor_faults + major_faults);
+  }
+}
+
+CDSStatistics::PhaseTimer::PhaseTimer(Phase phase) :
+  _phase(phase), _start(0),
+  _start_minor_faults(0), _start_major_faults(0), _bytes(0),
+  _active(RecordCDSStatistics),
+  _count_faults(_active && phase != restore_classes) {
+  if (!_active) {
+    return;
+  }
+  _start = os::elapsed_counter();
+  if (_count_faults && !os::page_fault_counts(&_start_minor_faults, &_start_major_faults)) {
+    _count_faults = false;
+  }
+}
+
+CDSStatistics::PhaseTimer::~PhaseTimer() {
+  if (!_active) {
+    return;
+  }
+  jlong minor_faults = 0;
+  jlong major_faults = 0;
+  if (_count_faults && os::page_fault_counts(&minor_faults, &major_faults)) {
+    minor_faults -= _start_minor_faults;
+    major_faults -= _start_major_faults;
+  } else {
+    minor_faults = major_faults = 0;
+  }
+  record(_phase, os::elapsed_counter() - _start, _bytes, minor_faults, major_faults);
+}
+
+void CDSStatistics::print_on(outputStream* st) {
+  st->print_cr("%-20s %8s %12s %14s %10s %10s", "Phase", "Count", "Time (ms)", "Bytes", "Minor PF", "Major PF");
+  for (int i = 0; i < num_phases; i++) {
+    Phase phase = (Phase)i;
+    st->print_cr("%-20s " JLONG_FORMAT_W(8) " %12.3f " JLONG_FORMAT_W(14) " " JLONG_FORMAT_W(10) " " JLONG_FORMAT_W(10),
+                 phase_name(phase), count(phase),
+                 TimeHelper::counter_to_millis(ticks(phase)),
+                 bytes(phase), minor_faults(phase), major_faults(phase));
+  }
+}
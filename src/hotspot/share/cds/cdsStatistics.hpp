@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_CDS_CDSSTATISTICS_HPP
+#define SHARE_CDS_CDSSTATISTICS_HPP
+
+#include "memory/allocation.hpp"
+#include "memory/allStatic.hpp"
+#include "runtime/perfDataTypes.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// Time, byte and page fault counts of the phases of mapping and loading the
+// CDS archive(s) at runtime. They are exported as jvmstat counters (sun.cls.cds.*),
+// in the CDSPhaseStatistics JFR event and by "jcmd <pid> VM.cds stats".
+// Nothing is recorded unless -XX:+RecordCDSStatistics is specified, since
+// restore_classes is measured on the class loading path.
+//
+// The page fault counts are process-wide, so they also include the faults taken
+// by other threads while a phase was running. They are not collected for
+// restore_classes, which runs once per loaded class.
+class CDSStatistics : AllStatic {
+ public:
+  enum Phase {
+    map_regions,              // FileMapInfo::map_regions
+    relocate,                 // FileMapInfo::relocate_pointers_in_core_regions
+    map_heap,                 // FileMapInfo::map_or_load_heap_region
+    fixup_heap,               // ArchiveHeapLoader::fixup_region
+    patch_native_pointers,    // ArchiveHeapLoader::patch_native_pointers
+    init_subgraphs,           // HeapShared::initialize_from_archived_subgraph
+    restore_classes,          // InstanceKlass::restore_unshareable_info
+    num_phases
+  };
+
+ private:
+  static jlong _ticks[num_phases];
+  static jlong _bytes[num_phases];
+  static jlong _count[num_phases];
+  static jlong _minor_faults[num_phases];
+  static jlong _major_faults[num_phases];
+
+  static PerfCounter* _perf_ticks[num_phases];
+  static PerfCounter* _perf_bytes[num_phases];
+  static PerfCounter* _perf_faults[num_phases];
+
+  static void record(Phase phase, jlong ticks, jlong bytes, jlong minor_faults, jlong major_faults);
+
+ public:
+  // Measures one execution of a phase. Nested executions of the same phase
+  // (e.g., a subgraph initialized from the <clinit> of another subgraph class)
+  // are included in the time of the outer one as well.
+  class PhaseTimer : public StackObj {
+    Phase _phase;
+    jlong _start;
+    jlong _start_minor_faults;
+    jlong _start_major_faults;
+    jlong _bytes;
+    bool  _active;
+    bool  _count_faults;
+   public:
+    PhaseTimer(Phase phase);
+    ~PhaseTimer();
+    void add_bytes(size_t bytes) { _bytes += (jlong)bytes; }
+  };
+
+  static void initialize();
+
+  static const char* phase_name(Phase phase);
+  static jlong ticks(Phase phase)        { return _ticks[phase]; }
+  static jlong bytes(Phase phase)        { return _bytes[phase]; }
+  static jlong count(Phase phase)        { return _count[phase]; }
+  static jlong minor_faults(Phase phase) { return _minor_faults[phase]; }
+  static jlong major_faults(Phase phase) { return _major_faults[phase]; }
+
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_CDS_CDSSTATISTICS_HPP
@@ -49,6 +49,12 @@
   product(bool, AutoCreateSharedArchive, false,                             \
           "Create shared archive at exit if cds mapping failed")            \
                                                                             \
+  product(uint, AutoCreateSharedArchiveDelay, 0,                            \
+          "If non-zero, the archive of -XX:+AutoCreateSharedArchive is "    \
+          "created by a background thread this many seconds after "         \
+          "startup, instead of at exit")                                    \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, PrintSharedArchiveAndExit, false,                           \
           "Print shared archive file contents")                             \
                                                                             \
@@ -76,6 +82,46 @@
           "Dump the names all loaded classes, that could be stored into "   \
           "the CDS archive, in the specified file")                         \
                                                                             \
+  product(bool, ArchiveCompilations, false,                                 \
+          "Record the methods compiled by C1 or C2 into the "               \
+          "DumpLoadedClassList, and enqueue the archived methods for "      \
+          "compilation as soon as their holder class is initialized")       \
+                                                                            \
+  product(bool, ArchiveClassInitOrder, false,                               \
+          "Record the order in which classes are initialized into the "     \
+          "DumpLoadedClassList. When dumping with such a classlist, the "   \
+          "metadata of these classes is laid out first, in that order")     \
+                                                                            \
+  product(ccstrlist, PreInitializeArchivedClasses, "",                      \
+          "Comma-separated list of classes that are initialized when the "  \
+          "static archive is dumped. Their static fields are restored "     \
+          "from the archived heap at run time instead of running <clinit>") \
+                                                                            \
+  product(bool, ArchiveMethodCounters, false,                               \
+          "Store the invocation and backedge counters of the archived "     \
+          "methods into the dynamic archive, so that the methods start "    \
+          "with the counts collected during the training run")              \
+                                                                            \
+  product(bool, CompressArchiveRegions, false,                              \
+          "Compress the metadata and bitmap regions of the CDS archive. "   \
+          "Compressed regions are decompressed into memory at startup "     \
+          "instead of being mapped from the archive file")                  \
+                                                                            \
+  product(bool, ArchiveRegionsOnLargePages, false,                          \
+          "Read the metadata regions of the CDS archive into memory that "  \
+          "is backed by transparent huge pages, instead of mapping them "   \
+          "from the archive file. Requires -XX:+UseTransparentHugePages")   \
+                                                                            \
+  product(bool, PrefetchArchiveRegions, false,                              \
+          "Ask the OS to start reading in the metadata regions of the CDS " \
+          "archive as soon as they are mapped, so that the page faults "    \
+          "overlap with the rest of the VM initialization")                 \
+                                                                            \
+  product(bool, RecordCDSStatistics, false,                                 \
+          "Record the time, bytes and page faults of the phases of mapping "\
+          "and loading the CDS archive(s), for jcmd VM.cds stats, JFR and " \
+          "jvmstat")                                                        \
+                                                                            \
   product(ccstr, SharedClassListFile, nullptr,                              \
           "Override the default CDS class list")                            \
                                                                             \
@@ -95,6 +141,10 @@
            "(2) always map at preferred address, and if unsuccessful, "     \
            "do not map the archive")                                        \
            range(0, 2)                                                      \
+                                                                            \
+  product(bool, ArchiveParallelRelocation, true, DIAGNOSTIC,                \
+          "Use helper threads to relocate the pointers in the archive "     \
+          "when it's not mapped at the requested address")                  \
 // end of CDS_FLAGS
 
 DECLARE_FLAGS(CDS_FLAGS)
@@ -35,6 +35,7 @@
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "compiler/compilerDefinitions.hpp"
 #include "interpreter/bytecode.hpp"
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/linkResolver.hpp"
@@ -112,6 +113,19 @@ int ClassListParser::parse(TRAPS) {
       continue;
     }
 
+    if (compiled_method_line()) {
+      // The current line is "@compiled-method ...". The holder class has been loaded by
+      // an earlier line, so the method can be marked right away.
+      record_compiled_method();
+      continue;
+    }
+
+    if (class_init_line()) {
+      // The current line is "@class-init ...". The class has been loaded by an earlier line.
+      record_class_init();
+      continue;
+    }
+
     TempNewSymbol class_name_symbol = SymbolTable::new_symbol(_class_name);
     if (_indy_items->length() > 0) {
       // The current line is "@lambda-proxy class_name". Load the proxy class.
@@ -212,6 +226,8 @@ bool ClassListParser::parse_one_line() {
   _interfaces_specified = false;
   _indy_items->clear();
   _lambda_form_line = false;
+  _compiled_method_line = false;
+  _class_init_line = false;
 
   if (_line[0] == '@') {
     return parse_at_tags();
@@ -314,6 +330,22 @@ bool ClassListParser::parse_at_tags() {
     LambdaFormInvokers::append(os::strdup((const char*)(_line + offset), mtInternal));
     _lambda_form_line = true;
     return true;
+  } else if (strcmp(_token, COMPILED_METHOD_TAG) == 0) {
+    split_tokens_by_whitespace(offset);
+    if (_indy_items->length() != 4) {
+      error("Line with @ tag has wrong number of items \"%s\" line #%d", _token, _line_no);
+      return false;
+    }
+    _compiled_method_line = true;
+    return true;
+  } else if (strcmp(_token, CLASS_INIT_TAG) == 0) {
+    split_tokens_by_whitespace(offset);
+    if (_indy_items->length() != 1) {
+      error("Line with @ tag has wrong number of items \"%s\" line #%d", _token, _line_no);
+      return false;
+    }
+    _class_init_line = true;
+    return true;
   } else {
     error("Invalid @ tag at the beginning of line \"%s\" line #%d", _token, _line_no);
     return false;
@@ -556,6 +588,65 @@ void ClassListParser::resolve_indy(JavaThread* current, Symbol* class_name_symbo
   }
 }
 
+// "@compiled-method <class id> <method name> <signature> <comp level>" lines are written
+// by ClassListWriter::write_compiled_method() when -XX:+ArchiveCompilations is specified.
+// The archived Method is marked so that it can be compiled eagerly at runtime (see
+// CompilationPolicy::compile_archived_methods()).
+void ClassListParser::record_compiled_method() {
+  assert(compiled_method_line() && _indy_items->length() == 4, "sanity");
+  int id;
+  int comp_level;
+  if (sscanf(_indy_items->at(0), "%i", &id) != 1 ||
+      sscanf(_indy_items->at(3), "%i", &comp_level) != 1) {
+    error("Error: expected integer");
+  }
+  InstanceKlass** klass_ptr = id2klass_table()->get(id);
+  if (klass_ptr == nullptr) {
+    // The class failed to load at dump time. A warning has already been printed.
+    return;
+  }
+  InstanceKlass* ik = *klass_ptr;
+  const char* name = _indy_items->at(1);
+  const char* signature = _indy_items->at(2);
+  Symbol* name_sym = SymbolTable::probe(name, (int)strlen(name));
+  Symbol* signature_sym = SymbolTable::probe(signature, (int)strlen(signature));
+  Method* m = (name_sym != nullptr && signature_sym != nullptr) ? ik->find_method(name_sym, signature_sym) : nullptr;
+  if (m == nullptr) {
+    ResourceMark rm;
+    log_warning(cds)("Cannot find method %s%s in class %s", name, signature, ik->external_name());
+    return;
+  }
+
+  if (comp_level == CompLevel_full_optimization) {
+    m->set_has_archived_c2_compilation();
+  } else if (comp_level == CompLevel_simple) {
+    m->set_has_archived_c1_compilation();
+  } else {
+    error("Unsupported compilation level %d", comp_level);
+  }
+  if (log_is_enabled(Trace, cds)) {
+    ResourceMark rm;
+    log_trace(cds)("Archived compilation: %s (level %d)", m->external_name(), comp_level);
+  }
+}
+
+// "@class-init <class id>" lines are written by ClassListWriter::write_class_init() when
+// -XX:+ArchiveClassInitOrder is specified. They tell ArchiveBuilder to lay out the
+// metadata of the classes used during startup first (see ArchiveBuilder::sort_klasses()).
+void ClassListParser::record_class_init() {
+  assert(class_init_line() && _indy_items->length() == 1, "sanity");
+  int id;
+  if (sscanf(_indy_items->at(0), "%i", &id) != 1) {
+    error("Error: expected integer");
+  }
+  InstanceKlass** klass_ptr = id2klass_table()->get(id);
+  if (klass_ptr == nullptr) {
+    // The class failed to load at dump time. A warning has already been printed.
+    return;
+  }
+  SystemDictionaryShared::record_class_init_order(*klass_ptr);
+}
+
 void ClassListParser::resolve_indy_impl(Symbol* class_name_symbol, TRAPS) {
   Handle class_loader(THREAD, SystemDictionary::java_system_loader());
   Handle protection_domain;
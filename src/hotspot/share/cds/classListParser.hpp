@@ -32,6 +32,8 @@
 
 #define LAMBDA_PROXY_TAG "@lambda-proxy"
 #define LAMBDA_FORM_TAG  "@lambda-form-invoker"
+#define COMPILED_METHOD_TAG "@compiled-method"
+#define CLASS_INIT_TAG "@class-init"
 
 class constantPoolHandle;
 class Thread;
@@ -114,6 +116,8 @@ class ClassListParser : public StackObj {
   bool                _interfaces_specified;
   const char*         _source;
   bool                _lambda_form_line;
+  bool                _compiled_method_line;
+  bool                _class_init_line;
   ParseMode           _parse_mode;
 
   bool parse_int_option(const char* option_name, int* value);
@@ -129,6 +133,8 @@ class ClassListParser : public StackObj {
 
   void resolve_indy(JavaThread* current, Symbol* class_name_symbol);
   void resolve_indy_impl(Symbol* class_name_symbol, TRAPS);
+  void record_compiled_method();
+  void record_class_init();
   bool parse_one_line();
   Klass* load_current_class(Symbol* class_name_symbol, TRAPS);
 
@@ -191,6 +197,8 @@ class ClassListParser : public StackObj {
   bool is_loading_from_source();
 
   bool lambda_form_line() { return _lambda_form_line; }
+  bool compiled_method_line() { return _compiled_method_line; }
+  bool class_init_line() { return _class_init_line; }
 
   // Look up the super or interface of the current class being loaded
   // (in this->load_current_class()).
@@ -24,14 +24,17 @@
 
 #include "precompiled.hpp"
 #include "cds/cds_globals.hpp"
+#include "cds/classListParser.hpp"
 #include "cds/classListWriter.hpp"
 #include "classfile/classFileStream.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/classLoaderData.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "compiler/compilerDefinitions.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
 #include "runtime/mutexLocker.hpp"
 
 fileStream* ClassListWriter::_classlist_file = nullptr;
@@ -184,6 +187,48 @@ void ClassListWriter::write_to_stream(const InstanceKlass* k, outputStream* stre
   stream->flush();
 }
 
+// Record a successful compilation of m, so that the method can be compiled eagerly
+// when running with the archive (see ClassListParser::record_compiled_method()).
+// Only the final tiers are recorded: code compiled at CompLevel_limited_profile and
+// CompLevel_full_profile is transient and will be replaced once the profile matures.
+void ClassListWriter::write_compiled_method(const Method* m, int comp_level) {
+  assert(is_enabled(), "must be");
+  if (!ArchiveCompilations) {
+    return;
+  }
+  if (comp_level != CompLevel_simple && comp_level != CompLevel_full_optimization) {
+    return;
+  }
+
+  ClassListWriter w;
+  const InstanceKlass* k = m->method_holder();
+  if (!has_id(k)) {
+    // The holder has not been written into the classlist.
+    return;
+  }
+  ResourceMark rm;
+  w.stream()->print_cr("%s %d %s %s %d", COMPILED_METHOD_TAG, get_id(k),
+                       m->name()->as_C_string(), m->signature()->as_C_string(), comp_level);
+  w.stream()->flush();
+}
+
+// Record the order in which the classes are initialized. The metadata of these classes
+// are laid out first in the archive (see ClassListParser::record_class_init()).
+void ClassListWriter::write_class_init(const InstanceKlass* k) {
+  assert(is_enabled(), "must be");
+  if (!ArchiveClassInitOrder) {
+    return;
+  }
+
+  ClassListWriter w;
+  if (!has_id(k)) {
+    // The class has not been written into the classlist.
+    return;
+  }
+  w.stream()->print_cr("%s %d", CLASS_INIT_TAG, get_id(k));
+  w.stream()->flush();
+}
+
 void ClassListWriter::delete_classlist() {
   if (_classlist_file != nullptr) {
     delete _classlist_file;
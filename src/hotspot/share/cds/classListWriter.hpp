@@ -30,6 +30,7 @@
 #include "utilities/ostream.hpp"
 
 class ClassFileStream;
+class Method;
 
 class ClassListWriter {
 #if INCLUDE_CDS
@@ -66,6 +67,8 @@ class ClassListWriter {
   static void init() NOT_CDS_RETURN;
   static void write(const InstanceKlass* k, const ClassFileStream* cfs) NOT_CDS_RETURN;
   static void write_to_stream(const InstanceKlass* k, outputStream* stream, const ClassFileStream* cfs = nullptr) NOT_CDS_RETURN;
+  static void write_compiled_method(const Method* m, int comp_level) NOT_CDS_RETURN;
+  static void write_class_init(const InstanceKlass* k) NOT_CDS_RETURN;
   static void delete_classlist() NOT_CDS_RETURN;
 };
 
@@ -27,10 +27,14 @@
 #include "cds/classPrelinker.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
+#include "interpreter/bytecodeStream.hpp"
+#include "interpreter/interpreterRuntime.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/constantPool.inline.hpp"
+#include "oops/cpCache.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
+#include "oops/resolvedFieldEntry.hpp"
 #include "runtime/handles.inline.hpp"
 
 ClassPrelinker::ClassesTable* ClassPrelinker::_processed_classes = nullptr;
@@ -139,6 +143,62 @@ void ClassPrelinker::dumptime_resolve_constants(InstanceKlass* ik, TRAPS) {
       break;
     }
   }
+
+  preresolve_field_cp_entries(ik, CHECK);
+}
+
+bool ClassPrelinker::can_archive_resolved_field(ConstantPool* cp, int cp_index) {
+  assert(!is_in_archivebuilder_buffer(cp), "sanity");
+  assert(cp->tag_at(cp_index).is_field(), "must be");
+
+  int klass_cp_index = cp->uncached_klass_ref_index_at(cp_index);
+  if (!cp->tag_at(klass_cp_index).is_klass()) {
+    // The referenced class has not been resolved.
+    return false;
+  }
+  Klass* k = cp->resolved_klass_at(klass_cp_index);
+  if (!k->is_instance_klass()) {
+    return false;
+  }
+
+  // The field is looked up in k and its supertypes, which are loaded before k is
+  // defined, so the resolution result is the same at both dump time and run time.
+  return can_archive_resolved_klass(cp->pool_holder(), k);
+}
+
+// Resolve the getfield/putfield bytecodes whose classes have been resolved by
+// maybe_resolve_class(), so that the interpreter does not need to call into
+// LinkResolver at runtime.
+void ClassPrelinker::preresolve_field_cp_entries(InstanceKlass* ik, TRAPS) {
+  constantPoolHandle cp(THREAD, ik->constants());
+  if (cp->cache() == nullptr || cp->cache()->resolved_field_entries_length() == 0) {
+    return;
+  }
+
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    methodHandle mh(THREAD, methods->at(i));
+    BytecodeStream bcs(mh);
+    Bytecodes::Code code;
+    while ((code = bcs.next()) >= 0) {
+      if (code != Bytecodes::_getfield && code != Bytecodes::_putfield) {
+        continue;
+      }
+      int field_index = bcs.get_index_u2();
+      ResolvedFieldEntry* rfe = cp->resolved_field_entry_at(field_index);
+      if (rfe->is_resolved(code) || !can_archive_resolved_field(cp(), rfe->constant_pool_index())) {
+        continue;
+      }
+      InterpreterRuntime::resolve_get_put(code, field_index, mh, cp, THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        if (PENDING_EXCEPTION->is_a(vmClasses::OutOfMemoryError_klass())) {
+          return; // THROW
+        }
+        // The same error will be thrown when the bytecode is executed at runtime.
+        CLEAR_PENDING_EXCEPTION;
+      }
+    }
+  }
 }
 
 Klass* ClassPrelinker::find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name) {
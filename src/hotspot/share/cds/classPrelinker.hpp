@@ -67,6 +67,7 @@ class ClassPrelinker :  AllStatic {
   static Klass* maybe_resolve_class(constantPoolHandle cp, int cp_index, TRAPS);
   static bool can_archive_resolved_klass(InstanceKlass* cp_holder, Klass* resolved_klass);
   static Klass* find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name);
+  static void preresolve_field_cp_entries(InstanceKlass* ik, TRAPS);
 
 public:
   static void initialize();
@@ -86,6 +87,11 @@ class ClassPrelinker :  AllStatic {
   // the result in the CDS archive? Returns true if cp_index is guaranteed to
   // resolve to the same InstanceKlass* at both dump time and run time.
   static bool can_archive_resolved_klass(ConstantPool* cp, int cp_index);
+
+  // Can we store the ResolvedFieldEntry of the CONSTANT_Fieldref at cp_index in the
+  // CDS archive? Only getfield/putfield are considered: a resolved getstatic/putstatic
+  // would bypass the class initialization check at runtime.
+  static bool can_archive_resolved_field(ConstantPool* cp, int cp_index);
 };
 
 #endif // SHARE_CDS_CLASSPRELINKER_HPP
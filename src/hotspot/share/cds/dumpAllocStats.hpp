@@ -67,6 +67,8 @@ class DumpAllocStats : public StackObj {
 
   int _num_klass_cp_entries;
   int _num_klass_cp_entries_archived;
+  int _num_field_cp_entries;
+  int _num_field_cp_entries_archived;
 
 public:
   enum { RO = 0, RW = 1 };
@@ -76,6 +78,8 @@ class DumpAllocStats : public StackObj {
     memset(_bytes,  0, sizeof(_bytes));
     _num_klass_cp_entries = 0;
     _num_klass_cp_entries_archived = 0;
+    _num_field_cp_entries = 0;
+    _num_field_cp_entries_archived = 0;
   };
 
   CompactHashtableStats* symbol_stats() { return &_symbol_stats; }
@@ -107,6 +111,11 @@ class DumpAllocStats : public StackObj {
     _num_klass_cp_entries_archived += archived ? 1 : 0;
   }
 
+  void record_field_cp_entry(bool archived) {
+    _num_field_cp_entries ++;
+    _num_field_cp_entries_archived += archived ? 1 : 0;
+  }
+
   void print_stats(int ro_all, int rw_all);
 };
 
@@ -122,6 +122,7 @@ class DumpTimeClassInfo: public CHeapObj<mtClass> {
   bool                         _failed_verification;
   bool                         _is_archived_lambda_proxy;
   int                          _id;
+  int                          _init_order;
   int                          _clsfile_size;
   int                          _clsfile_crc32;
   GrowableArray<DTVerifierConstraint>* _verifier_constraints;
@@ -136,6 +137,7 @@ class DumpTimeClassInfo: public CHeapObj<mtClass> {
     _is_archived_lambda_proxy = false;
     _has_checked_exclusion = false;
     _id = -1;
+    _init_order = -1;
     _clsfile_size = -1;
     _clsfile_crc32 = -1;
     _excluded = false;
@@ -43,6 +43,8 @@
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/vmThread.hpp"
@@ -124,6 +126,8 @@ class DynamicArchiveBuilder : public ArchiveBuilder {
 
     log_info(cds, dynamic)("Copying %d klasses and %d symbols",
                            klasses()->length(), symbols()->length());
+    log_debug(cds, dynamic)("Java heap objects (mirrors, resolved references and strings) of these "
+                            "classes are not archived; dump them into the static archive to archive them");
     dump_rw_metadata();
     dump_ro_metadata();
     relocate_metaspaceobj_embedded_pointers();
@@ -389,6 +393,10 @@ class VM_PopulateDynamicDumpSharedSpace: public VM_GC_Sync_Operation {
     }
     FileMapInfo::check_nonempty_dir_in_shared_path_table();
 
+    if (DynamicArchive::is_background_dump_cancelled()) {
+      // The JVM started to exit before this operation got to run.
+      return;
+    }
     _builder.doit();
   }
   ~VM_PopulateDynamicDumpSharedSpace() {
@@ -489,6 +497,43 @@ void DynamicArchive::check_for_dynamic_dump() {
   }
 }
 
+// The dynamic archive is dumped at most once, either by the background thread
+// (see start_background_dump()) or at exit, whichever comes first.
+volatile int DynamicArchive::_dump_claimed = 0;
+
+bool DynamicArchive::claim_dump() {
+  return Atomic::cmpxchg(&_dump_claimed, 0, 1) == 0;
+}
+
+// State of the background dump, and the temporary file it is writing. The
+// temporary file is removed at exit unless the background dump has renamed it
+// into place by then.
+volatile int DynamicArchive::_background_dump_state = DynamicArchive::background_dump_none;
+char* DynamicArchive::_background_temp_name = nullptr;
+
+bool DynamicArchive::is_background_dump_cancelled() {
+  return Atomic::load_acquire(&_background_dump_state) == background_dump_cancelled;
+}
+
+// Called at exit. Returns true if a background dump was in progress.
+bool DynamicArchive::cancel_background_dump() {
+  if (Atomic::cmpxchg(&_background_dump_state, (int)background_dump_running,
+                      (int)background_dump_cancelled) != background_dump_running) {
+    return false;
+  }
+  // Any VM_PopulateDynamicDumpSharedSpace operation of the background thread has
+  // either completed or will see the cancellation, and will not write the file.
+  remove(_background_temp_name);
+  return true;
+}
+
+// The dynamic archive is always regenerated from scratch. Reusing the records of
+// a previous top archive is not possible: ArchiveBuilder copies and relocates all
+// metadata into a new buffer, so a RunTimeClassInfo cannot be copied byte-for-byte
+// without also copying (and re-relocating) everything it points to. Besides, when
+// -XX:ArchiveClassesAtExit is specified, the previous top archive is not mapped
+// (see MetaspaceShared::open_dynamic_archive()), and its classes are loaded from
+// the class path, so they are dumped again like any other class.
 void DynamicArchive::dump_at_exit(JavaThread* current, const char* archive_name) {
   ExceptionMark em(current);
   ResourceMark rm(current);
@@ -497,6 +542,16 @@ void DynamicArchive::dump_at_exit(JavaThread* current, const char* archive_name)
     return;
   }
 
+  if (cancel_background_dump()) {
+    log_info(cds, dynamic)("Dynamic dump in the background thread has been cancelled");
+    return;
+  }
+
+  if (!claim_dump()) {
+    log_info(cds, dynamic)("Dynamic archive has been dumped by the background thread");
+    return;
+  }
+
   log_info(cds, dynamic)("Preparing for dynamic dump at exit in thread %s", current->name());
 
   JavaThread* THREAD = current; // For TRAPS processing related to link_shared_classes
@@ -519,6 +574,111 @@ void DynamicArchive::dump_at_exit(JavaThread* current, const char* archive_name)
   DynamicDumpSharedSpaces = false;  // Just for good measure
 }
 
+// With -XX:+AutoCreateSharedArchive -XX:AutoCreateSharedArchiveDelay=<n>, the
+// dynamic archive is regenerated by a daemon thread <n> seconds after startup,
+// so that the JVM does not pay for it at exit. The archive is written into a
+// temporary file, which is renamed to ArchiveClassesAtExit only after it has been
+// completely written. If the JVM exits before the background dump has completed,
+// the dump is cancelled, the temporary file is removed, and the old archive is
+// left untouched.
+void DynamicArchive::start_background_dump(TRAPS) {
+  if (!AutoCreateSharedArchive || AutoCreateSharedArchiveDelay == 0 ||
+      !DynamicDumpSharedSpaces || ArchiveClassesAtExit == nullptr) {
+    return;
+  }
+
+  const char* name = "CDS Archive Dumper";
+  Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+  JavaThread* thread = new JavaThread(&background_dump_thread_entry);
+  JavaThread::vm_exit_on_osthread_failure(thread);
+
+  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+}
+
+void DynamicArchive::background_dump_thread_entry(JavaThread* current, TRAPS) {
+  current->sleep((jlong)AutoCreateSharedArchiveDelay * MILLIUNITS);
+
+  if (!DynamicDumpSharedSpaces) {
+    return;
+  }
+
+  // Publish the temporary file name before claiming the dump, so that an exit
+  // racing with the claim either cancels this dump or does the dump itself.
+  const char* archive_name = ArchiveClassesAtExit;
+  size_t len = strlen(archive_name) + 32;
+  _background_temp_name = NEW_C_HEAP_ARRAY(char, len, mtClassShared);
+  jio_snprintf(_background_temp_name, len, "%s.%d.tmp", archive_name, os::current_process_id());
+  Atomic::release_store(&_background_dump_state, (int)background_dump_running);
+
+  if (!claim_dump()) {
+    // The JVM has started to exit, which dumps the archive if still needed.
+    Atomic::cmpxchg(&_background_dump_state, (int)background_dump_running, (int)background_dump_none);
+    return;
+  }
+
+  background_dump(current, archive_name, _background_temp_name);
+
+  if (Atomic::cmpxchg(&_background_dump_state, (int)background_dump_running,
+                      (int)background_dump_done) == background_dump_running) {
+    // Not cancelled at exit, so the temporary file name is no longer used.
+    FREE_C_HEAP_ARRAY(char, _background_temp_name);
+    _background_temp_name = nullptr;
+  }
+
+  // Whatever the outcome, the archive is not dumped again in this JVM.
+  DynamicDumpSharedSpaces = false;
+}
+
+void DynamicArchive::background_dump(JavaThread* current, const char* archive_name, const char* temp_name) {
+  ResourceMark rm(current);
+  JavaThread* THREAD = current; // For TRAPS processing related to link_shared_classes
+
+  log_info(cds, dynamic)("Preparing for dynamic dump in background thread %s", current->name());
+
+  // Regenerate the LambdaForm holder classes, as for the dump at exit, so that they
+  // contain the invokers of both the base archive and this run. Unlike
+  // "jcmd VM.cds dynamic_dump", which may be issued many times, this dump
+  // happens only once, so the holder classes are regenerated only once.
+  MetaspaceShared::link_shared_classes(false/*not from jcmd*/, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    oop ex = current->pending_exception();
+    log_error(cds)("Dynamic dump has failed");
+    log_error(cds)("%s: %s", ex->klass()->external_name(),
+                   java_lang_String::as_utf8_string(java_lang_Throwable::message(ex)));
+    CLEAR_PENDING_EXCEPTION;
+    return;
+  }
+
+  {
+    VM_PopulateDynamicDumpSharedSpace op(temp_name);
+    VMThread::execute(&op);
+  }
+
+  if (is_background_dump_cancelled()) {
+    // The temporary file has been removed at exit.
+    return;
+  }
+  if (!os::file_exists(temp_name)) {
+    log_warning(cds, dynamic)("Dynamic archive was not written");
+    return;
+  }
+#ifdef _WINDOWS
+  // On Windows, rename() fails if the destination exists.
+  chmod(archive_name, _S_IREAD | _S_IWRITE);
+  remove(archive_name);
+#endif
+  if (rename(temp_name, archive_name) != 0) {
+    if (!is_background_dump_cancelled()) {
+      log_warning(cds, dynamic)("Unable to rename %s to %s: (%s)", temp_name, archive_name,
+                                os::strerror(errno));
+      remove(temp_name);
+    }
+    return;
+  }
+  log_info(cds, dynamic)("Dynamic archive %s has been created in the background", archive_name);
+}
+
 // This is called by "jcmd VM.cds dynamic_dump"
 void DynamicArchive::dump_for_jcmd(const char* archive_name, TRAPS) {
   assert(UseSharedSpaces && RecordDynamicDumpInfo, "already checked in arguments.cpp");
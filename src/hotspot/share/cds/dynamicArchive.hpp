@@ -63,10 +63,26 @@ class DynamicArchive : AllStatic {
 private:
   static GrowableArray<ObjArrayKlass*>* _array_klasses;
   static Array<ObjArrayKlass*>* _dynamic_archive_array_klasses;
+  static volatile int _dump_claimed;
+  static bool claim_dump();
+
+  enum {
+    background_dump_none,
+    background_dump_running,
+    background_dump_done,
+    background_dump_cancelled
+  };
+  static volatile int _background_dump_state;
+  static char* _background_temp_name;
+  static bool cancel_background_dump();
+  static void background_dump_thread_entry(JavaThread* current, TRAPS);
+  static void background_dump(JavaThread* current, const char* archive_name, const char* temp_name);
 public:
   static void check_for_dynamic_dump();
   static void dump_for_jcmd(const char* archive_name, TRAPS);
   static void dump_at_exit(JavaThread* current, const char* archive_name);
+  static void start_background_dump(TRAPS);
+  static bool is_background_dump_cancelled();
   static bool is_mapped() { return FileMapInfo::dynamic_info() != nullptr; }
   static bool validate(FileMapInfo* dynamic_info);
   static void dump_array_klasses();
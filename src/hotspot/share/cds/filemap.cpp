@@ -29,6 +29,7 @@
 #include "cds/archiveUtils.inline.hpp"
 #include "cds/cds_globals.hpp"
 #include "cds/cdsConfig.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "cds/dynamicArchive.hpp"
 #include "cds/filemap.hpp"
 #include "cds/heapShared.hpp"
@@ -63,12 +64,14 @@
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vm_version.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/classpathStream.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/zipLibrary.hpp"
 #if INCLUDE_G1GC
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/heapRegion.hpp"
@@ -231,6 +234,8 @@ void FileMapHeader::populate(FileMapInfo *info, size_t core_region_alignment,
   _verify_remote = BytecodeVerificationRemote;
   _has_platform_or_app_classes = ClassLoaderExt::has_platform_or_app_classes();
   _has_non_jar_in_classpath = ClassLoaderExt::has_non_jar_in_classpath();
+  const char* appcp = Arguments::get_appclasspath();
+  _app_class_path_crc = (appcp == nullptr) ? 0 : ClassLoader::crc32(0, appcp, (jint)strlen(appcp));
   _requested_base_address = (char*)SharedBaseAddress;
   _mapped_base_address = (char*)SharedBaseAddress;
   _allow_archiving_with_java_agent = AllowArchivingWithJavaAgent;
@@ -286,6 +291,7 @@ void FileMapHeader::print(outputStream* st) {
   st->print_cr("- verify_remote:                  %d", _verify_remote);
   st->print_cr("- has_platform_or_app_classes:    %d", _has_platform_or_app_classes);
   st->print_cr("- has_non_jar_in_classpath:       %d", _has_non_jar_in_classpath);
+  st->print_cr("- app_class_path_crc:             0x%08x", _app_class_path_crc);
   st->print_cr("- requested_base_address:         " INTPTR_FORMAT, p2i(_requested_base_address));
   st->print_cr("- mapped_base_address:            " INTPTR_FORMAT, p2i(_mapped_base_address));
   st->print_cr("- heap_roots_offset:              " SIZE_FORMAT, _heap_roots_offset);
@@ -777,6 +783,27 @@ bool FileMapInfo::check_paths(int shared_path_start_idx, int num_paths, Growable
   return false;
 }
 
+// Returns true if the entries of appcp are, string by string, the first num_paths
+// app class paths of the shared path table. This does not access the file system.
+bool FileMapInfo::same_app_class_path_strings(int num_paths, const char* appcp) {
+  ResourceMark rm;
+  ClasspathStream cp_stream(appcp);
+  int i = 0;
+  int j = header()->app_class_paths_start_index();
+  while (i < num_paths) {
+    while (shared_path(j)->from_class_path_attr()) {
+      // Not included in the -classpath VM argument, see check_paths().
+      j++;
+    }
+    if (!cp_stream.has_next() || strcmp(shared_path(j)->name(), cp_stream.get_next()) != 0) {
+      return false;
+    }
+    i++;
+    j++;
+  }
+  return !cp_stream.has_next();
+}
+
 bool FileMapInfo::validate_boot_class_paths() {
   //
   // - Archive contains boot classes only - relaxed boot path check:
@@ -853,6 +880,18 @@ bool FileMapInfo::validate_app_class_paths(int shared_app_paths_len) {
     return classpath_failure("Run time APP classpath is shorter than the one at dump time: ", appcp);
   }
   if (shared_app_paths_len != 0 && rp_len != 0) {
+    if (rp_len == shared_app_paths_len && !header()->has_non_jar_in_classpath() &&
+        header()->app_class_path_crc() == ClassLoader::crc32(0, appcp, (jint)strlen(appcp)) &&
+        same_app_class_path_strings(shared_app_paths_len, appcp)) {
+      // Fast path: the runtime -cp is the same string as at dump time, and all of
+      // its entries were in the dump time classpath (none of them was missing).
+      // These entries have been validated by validate_shared_path_table(), so
+      // there's no need to stat and compare them again. The CRC only saves the
+      // string comparisons when the -cp has changed.
+      log_info(class, path)("APP classpath is the same as at dump time");
+      return true;
+    }
+
     // Prefix is OK: E.g., dump with -cp foo.jar, but run with -cp foo.jar:bar.jar.
     ResourceMark rm;
     GrowableArray<const char*>* rp_array = create_path_array(appcp);
@@ -1337,7 +1376,7 @@ bool FileMapInfo::init_from_file(int fd) {
 
   for (int i = 0; i < MetaspaceShared::n_regions; i++) {
     FileMapRegion* r = region_at(i);
-    if (r->file_offset() > len || len - r->file_offset() < r->used()) {
+    if (r->file_offset() > len || len - r->file_offset() < r->size_in_file()) {
       log_warning(cds)("The shared archive file has been truncated.");
       return false;
     }
@@ -1430,6 +1469,7 @@ void FileMapRegion::init(int region_index, size_t mapping_offset, size_t size, b
   _is_bitmap_region = (region_index == MetaspaceShared::bm);
   _mapping_offset = mapping_offset;
   _used = size;
+  _compressed_size = 0;
   _read_only = read_only;
   _allow_exec = allow_exec;
   _crc = crc;
@@ -1502,11 +1542,38 @@ void FileMapRegion::print(outputStream* st, int region_index) {
   st->print_cr("- file_offset:                    " SIZE_FORMAT_X, _file_offset);
   st->print_cr("- mapping_offset:                 " SIZE_FORMAT_X, _mapping_offset);
   st->print_cr("- used:                           " SIZE_FORMAT, _used);
+  st->print_cr("- compressed_size:                " SIZE_FORMAT, _compressed_size);
   st->print_cr("- oopmap_offset:                  " SIZE_FORMAT_X, _oopmap_offset);
   st->print_cr("- oopmap_size_in_bits:            " SIZE_FORMAT, _oopmap_size_in_bits);
   st->print_cr("- mapped_base:                    " INTPTR_FORMAT, p2i(_mapped_base));
 }
 
+// Returns a C-heap buffer holding the gzip-compressed copy of [base, base + size), or
+// nullptr if the data cannot be compressed, or doesn't get any smaller when compressed.
+static char* compress_region_data(char* base, size_t size, size_t& compressed_size) {
+  const int level = 1; // favor dump time, the decompression speed is about the same for all levels
+  size_t out_size = 0;
+  size_t tmp_size = 0;
+  const char* msg = ZipLibrary::init_params(size, &out_size, &tmp_size, level);
+  if (msg != nullptr) {
+    log_warning(cds)("Cannot compress archive region: %s", msg);
+    return nullptr;
+  }
+  char* out = NEW_C_HEAP_ARRAY(char, out_size, mtClassShared);
+  char* tmp = NEW_C_HEAP_ARRAY(char, tmp_size, mtClassShared);
+  compressed_size = ZipLibrary::compress(base, size, out, out_size, tmp, tmp_size, level, nullptr, &msg);
+  FREE_C_HEAP_ARRAY(char, tmp);
+  if (msg != nullptr) {
+    log_warning(cds)("Cannot compress archive region: %s", msg);
+    compressed_size = 0;
+  }
+  if (compressed_size == 0 || compressed_size >= size) {
+    FREE_C_HEAP_ARRAY(char, out);
+    return nullptr;
+  }
+  return out;
+}
+
 void FileMapInfo::write_region(int region, char* base, size_t size,
                                bool read_only, bool allow_exec) {
   assert(CDSConfig::is_dumping_archive(), "sanity");
@@ -1551,6 +1618,21 @@ void FileMapInfo::write_region(int region, char* base, size_t size,
   r->init(region, mapping_offset, size, read_only, allow_exec, crc);
 
   if (base != nullptr) {
+    if (CompressArchiveRegions && size > 0 && !HeapShared::is_heap_region(region)) {
+      // The heap region is never compressed, so that it can still be mapped directly
+      // into the Java heap at runtime.
+      size_t compressed_size = 0;
+      char* compressed = compress_region_data(base, size, compressed_size);
+      if (compressed != nullptr) {
+        log_info(cds)("Compressed region (%s) %d: " SIZE_FORMAT " -> " SIZE_FORMAT " bytes (%5.1f%%)",
+                      region_name(region), region, size, compressed_size,
+                      percent_of(compressed_size, size));
+        r->set_compressed_size(compressed_size);
+        write_bytes_aligned(compressed, compressed_size);
+        FREE_C_HEAP_ARRAY(char, compressed);
+        return;
+      }
+    }
     write_bytes_aligned(base, size);
   }
 }
@@ -1707,6 +1789,7 @@ bool FileMapInfo::remap_shared_readonly_as_readwrite() {
 static const char* shared_region_name[] = { "ReadWrite", "ReadOnly", "Bitmap", "Heap" };
 
 MapArchiveResult FileMapInfo::map_regions(int regions[], int num_regions, char* mapped_base_address, ReservedSpace rs) {
+  CDSStatistics::PhaseTimer phase_timer(CDSStatistics::map_regions);
   DEBUG_ONLY(FileMapRegion* last_region = nullptr);
   intx addr_delta = mapped_base_address - header()->requested_base_address();
 
@@ -1721,6 +1804,13 @@ MapArchiveResult FileMapInfo::map_regions(int regions[], int num_regions, char*
       return result;
     }
     FileMapRegion* r = region_at(idx);
+    phase_timer.add_bytes(r->used_aligned());
+    if (PrefetchArchiveRegions && r->mapped_from_file()) {
+      // The kernel reads ahead asynchronously. The metadata of the classes that
+      // are used at startup is laid out first (see ArchiveClassInitOrder), so
+      // it is read in first.
+      os::prefetch_memory(r->mapped_base(), r->used_aligned());
+    }
     DEBUG_ONLY(if (last_region != nullptr) {
         // Ensure that the OS won't be able to allocate new memory spaces between any mapped
         // regions, or else it would mess up the simple comparison in MetaspaceObj::is_shared().
@@ -1752,9 +1842,17 @@ bool FileMapInfo::read_region(int i, char* base, size_t size, bool do_commit) {
                      i, shared_region_name[i]);
       return false;
     }
+    if (ArchiveRegionsOnLargePages) {
+      // Must be done before the memory is touched. See use_large_pages_for_regions().
+      os::realign_memory(base, size, os::large_page_size());
+    }
   }
-  if (os::lseek(_fd, (long)r->file_offset(), SEEK_SET) != (int)r->file_offset() ||
-      read_bytes(base, size) != size) {
+  if (r->is_compressed()) {
+    if (!read_compressed_region(i, base)) {
+      return false;
+    }
+  } else if (os::lseek(_fd, (long)r->file_offset(), SEEK_SET) != (int)r->file_offset() ||
+             read_bytes(base, size) != size) {
     return false;
   }
 
@@ -1768,6 +1866,45 @@ bool FileMapInfo::read_region(int i, char* base, size_t size, bool do_commit) {
   return true;
 }
 
+// Decompress the contents of region #i, as stored in the archive file, into [base, base + used()).
+// The caller is responsible for committing the memory.
+bool FileMapInfo::read_compressed_region(int i, char* base) {
+  FileMapRegion* r = region_at(i);
+  assert(r->is_compressed(), "must be");
+  size_t compressed_size = r->compressed_size();
+  char* buffer = NEW_C_HEAP_ARRAY(char, compressed_size, mtClassShared);
+  if (os::lseek(_fd, (long)r->file_offset(), SEEK_SET) != (int)r->file_offset() ||
+      read_bytes(buffer, compressed_size) != compressed_size) {
+    FREE_C_HEAP_ARRAY(char, buffer);
+    return false;
+  }
+  const char* msg = nullptr;
+  size_t n = ZipLibrary::decompress(buffer, compressed_size, base, r->used(), &msg);
+  FREE_C_HEAP_ARRAY(char, buffer);
+  if (msg != nullptr || n != r->used()) {
+    log_warning(cds)("Unable to decompress %s region #%d (%s): %s", is_static() ? "static " : "dynamic",
+                     i, shared_region_name[i], msg != nullptr ? msg : "unexpected size");
+    return false;
+  }
+  log_info(cds)("Decompressed %s region #%d at base " INTPTR_FORMAT " (%s): " SIZE_FORMAT " -> " SIZE_FORMAT " bytes",
+                is_static() ? "static " : "dynamic", i, p2i(base), shared_region_name[i],
+                compressed_size, r->used());
+  return true;
+}
+
+// With -XX:+ArchiveRegionsOnLargePages, the core regions are read into the reserved
+// space, which is advised to be backed by transparent huge pages. This reduces the
+// TLB misses when accessing the archived metadata. A mapping of the archive file
+// cannot be backed by huge pages, so we lose the sharing of these pages between
+// processes.
+static bool use_large_pages_for_regions(ReservedSpace rs) {
+#ifdef LINUX
+  return ArchiveRegionsOnLargePages && UseTransparentHugePages && rs.is_reserved();
+#else
+  return false;
+#endif
+}
+
 MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_base_address, ReservedSpace rs) {
   assert(!HeapShared::is_heap_region(i), "sanity");
   FileMapRegion* r = region_at(i);
@@ -1777,6 +1914,7 @@ MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_ba
   assert(requested_addr != nullptr, "must be specified");
 
   r->set_mapped_from_file(false);
+  bool on_large_pages = use_large_pages_for_regions(rs);
 
   if (MetaspaceShared::use_windows_memory_mapping()) {
     // Windows cannot remap read-only shared memory to read-write when required for
@@ -1788,9 +1926,32 @@ MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_ba
     r->set_read_only(false);
   } else if (addr_delta != 0) {
     r->set_read_only(false); // Need to patch the pointers
+  } else if (r->is_compressed() || on_large_pages) {
+    r->set_read_only(false); // Read into committed (writable) memory
   }
 
-  if (MetaspaceShared::use_windows_memory_mapping() && rs.is_reserved()) {
+  if (r->is_compressed()) {
+    // A compressed region cannot be mapped from the file. Decompress it straight into
+    // the space that has been reserved for it.
+    if (!rs.is_reserved()) {
+      // Windows, first mapping attempt: fail so that the archive is mapped again into
+      // a ReservedSpace.
+      log_info(cds)("Compressed %s shared space requires reserved space", shared_region_name[i]);
+      _memory_mapping_failed = true;
+      return MAP_ARCHIVE_MMAP_FAILURE;
+    }
+    if (!read_region(i, requested_addr, size, /* do_commit = */ true)) {
+      log_info(cds)("Failed to decompress %s shared space into reserved space at " INTPTR_FORMAT,
+                    shared_region_name[i], p2i(requested_addr));
+      return MAP_ARCHIVE_OTHER_FAILURE; // oom, I/O or decompression error.
+    }
+  } else if (on_large_pages) {
+    if (!read_region(i, requested_addr, size, /* do_commit = */ true)) {
+      log_info(cds)("Failed to read %s shared space into large pages at " INTPTR_FORMAT,
+                    shared_region_name[i], p2i(requested_addr));
+      return MAP_ARCHIVE_OTHER_FAILURE; // oom or I/O error.
+    }
+  } else if (MetaspaceShared::use_windows_memory_mapping() && rs.is_reserved()) {
     // This is the second time we try to map the archive(s). We have already created a ReservedSpace
     // that covers all the FileMapRegions to ensure all regions can be mapped. However, Windows
     // can't mmap into a ReservedSpace, so we just ::read() the data. We're going to patch all the
@@ -1832,6 +1993,26 @@ char* FileMapInfo::map_bitmap_region() {
   if (r->mapped_base() != nullptr) {
     return r->mapped_base();
   }
+  if (r->is_compressed()) {
+    // The bitmap is only needed during startup, decompress it into the C heap.
+    // It's freed by unmap_region().
+    char* bitmap_base = NEW_C_HEAP_ARRAY(char, r->used(), mtClassShared);
+    if (!read_compressed_region(MetaspaceShared::bm, bitmap_base)) {
+      FREE_C_HEAP_ARRAY(char, bitmap_base);
+      log_info(cds)("failed to decompress relocation bitmap");
+      return nullptr;
+    }
+    r->set_mapped_base(bitmap_base);
+    if (VerifySharedSpaces && !r->check_region_crc()) {
+      log_error(cds)("relocation bitmap CRC error");
+      r->set_mapped_base(nullptr);
+      FREE_C_HEAP_ARRAY(char, bitmap_base);
+      return nullptr;
+    }
+    r->set_mapped_from_file(false);
+    return bitmap_base;
+  }
+
   bool read_only = true, allow_exec = false;
   char* requested_addr = nullptr; // allow OS to pick any location
   char* bitmap_base = map_memory(_fd, _full_path, r->file_offset(),
@@ -1858,11 +2039,40 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Relocates the pointers marked in [beg, end) of the ptrmap. The range is split
+// into chunks that are processed in parallel by the ArchiveWorkers.
+class SharedDataRelocationTask : public ArchiveWorkerTask {
+private:
+  BitMapView* const _ptrmap;
+  SharedDataRelocator* const _patcher;
+  const BitMap::idx_t _beg;
+  const BitMap::idx_t _end;
+
+public:
+  SharedDataRelocationTask(const char* name, BitMapView* ptrmap, SharedDataRelocator* patcher,
+                           BitMap::idx_t beg, BitMap::idx_t end) :
+    ArchiveWorkerTask(name), _ptrmap(ptrmap), _patcher(patcher), _beg(beg), _end(end) {}
+
+  void work(int chunk, int max_chunks) override {
+    BitMap::idx_t size = _end - _beg;
+    BitMap::idx_t chunk_beg = _beg + align_down(size * chunk / max_chunks, BitsPerWord);
+    BitMap::idx_t chunk_end = (chunk == max_chunks - 1) ? _end :
+                              _beg + align_down(size * (chunk + 1) / max_chunks, BitsPerWord);
+    _ptrmap->iterate(_patcher, chunk_beg, chunk_end);
+  }
+};
+
 // This is called when we cannot map the archive at the requested[ base address (usually 0x800000000).
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
+  CDSStatistics::PhaseTimer phase_timer(CDSStatistics::relocate);
+  elapsedTimer total_timer;
+  elapsedTimer bitmap_timer;
+  total_timer.start();
+  bitmap_timer.start();
   char* bitmap_base = map_bitmap_region();
+  bitmap_timer.stop();
 
   if (bitmap_base == nullptr) {
     return false; // OOM, or CRC check failure
@@ -1876,6 +2086,7 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
     // Patch all pointers in the mapped region that are marked by ptrmap.
     address patch_base = (address)mapped_base();
     address patch_end  = (address)mapped_end();
+    phase_timer.add_bytes(patch_end - patch_base);
 
     // the current value of the pointers to be patched must be within this
     // range (i.e., must be between the requested base address and the address of the current archive).
@@ -1890,11 +2101,34 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+
+    // Relocate one region at a time, so that we can tell how long each one takes.
+    ArchiveWorkers workers;
+    int num_helpers = 0;
+    const int core_regions[] = { MetaspaceShared::rw, MetaspaceShared::ro };
+    for (size_t n = 0; n < ARRAY_SIZE(core_regions); n++) {
+      int i = core_regions[n];
+      FileMapRegion* r = region_at(i);
+      BitMap::idx_t beg = MIN2(pointer_delta(r->mapped_base(), patch_base, sizeof(address)), ptrmap_size_in_bits);
+      BitMap::idx_t end = MIN2(pointer_delta(r->mapped_end(),  patch_base, sizeof(address)), ptrmap_size_in_bits);
+      if (beg >= end) {
+        continue;
+      }
+      elapsedTimer timer;
+      timer.start();
+      SharedDataRelocationTask task(shared_region_name[i], &ptrmap, &patcher, beg, end);
+      num_helpers = MAX2(num_helpers, workers.run_task(&task));
+      timer.stop();
+      log_info(cds, reloc)("relocated %s region (" SIZE_FORMAT " bits) in %.3f ms",
+                           shared_region_name[i], (size_t)(end - beg), timer.seconds() * MILLIUNITS);
+    }
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
-    log_debug(cds, reloc)("runtime archive relocation done");
+    total_timer.stop();
+    log_info(cds, reloc)("runtime archive relocation done: %.3f ms (bitmap %.3f ms), %d helper thread(s)",
+                         total_timer.seconds() * MILLIUNITS, bitmap_timer.seconds() * MILLIUNITS,
+                         num_helpers);
     return true;
   }
 }
@@ -1953,17 +2187,16 @@ void FileMapInfo::map_or_load_heap_region() {
   bool success = false;
 
   if (can_use_heap_region()) {
+    CDSStatistics::PhaseTimer phase_timer(CDSStatistics::map_heap);
+    phase_timer.add_bytes(region_at(MetaspaceShared::hp)->used());
     if (ArchiveHeapLoader::can_map()) {
       success = map_heap_region();
     } else if (ArchiveHeapLoader::can_load()) {
       success = ArchiveHeapLoader::load_heap_region(this);
+    } else if (ArchiveHeapLoader::can_stream()) {
+      success = ArchiveHeapLoader::stream_heap_region(this);
     } else {
-      if (!UseCompressedOops && !ArchiveHeapLoader::can_map()) {
-        // TODO - remove implicit knowledge of G1
-        log_info(cds)("Cannot use CDS heap data. UseG1GC is required for -XX:-UseCompressedOops");
-      } else {
-        log_info(cds)("Cannot use CDS heap data. UseEpsilonGC, UseG1GC, UseSerialGC or UseParallelGC are required.");
-      }
+      log_info(cds)("Cannot use CDS heap data. UseCompressedClassPointers is required.");
     }
   }
 
@@ -2030,7 +2263,8 @@ address FileMapInfo::heap_region_dumptime_address() {
   if (UseCompressedOops) {
     return /*dumptime*/ narrow_oop_base() + r->mapping_offset();
   } else {
-    return heap_region_requested_address();
+    // See ArchiveHeapWriter::set_requested_address().
+    return (address)ArchiveHeapWriter::NOCOOPS_REQUESTED_BASE;
   }
 }
 
@@ -2224,6 +2458,9 @@ void FileMapInfo::unmap_region(int i) {
       if (!os::unmap_memory(mapped_base, size)) {
         fatal("os::unmap_memory failed");
       }
+    } else if (i == MetaspaceShared::bm && r->is_compressed()) {
+      // See map_bitmap_region()
+      FREE_C_HEAP_ARRAY(char, mapped_base);
     }
     r->set_mapped_base(nullptr);
   }
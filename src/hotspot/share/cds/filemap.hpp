@@ -150,6 +150,9 @@ class FileMapRegion: private CDSFileMapRegion {
   size_t mapping_end_offset()       const { return _mapping_offset + used_aligned(); }
   size_t used()                     const { return _used; }
   size_t used_aligned()             const; // aligned up to MetaspaceShared::core_region_alignment()
+  size_t compressed_size()          const { return _compressed_size; }
+  bool   is_compressed()            const { return _compressed_size != 0; }
+  size_t size_in_file()             const { return is_compressed() ? _compressed_size : _used; }
   char*  mapped_base()              const { return _mapped_base; }
   char*  mapped_end()               const { return mapped_base()        + used_aligned(); }
   bool   read_only()                const { return _read_only != 0; }
@@ -162,6 +165,7 @@ class FileMapRegion: private CDSFileMapRegion {
   void set_read_only(bool v)         { _read_only = v; }
   void set_mapped_base(char* p)      { _mapped_base = p; }
   void set_mapped_from_file(bool v)  { _mapped_from_file = v; }
+  void set_compressed_size(size_t s) { _compressed_size = s; }
   void init(int region_index, size_t mapping_offset, size_t size, bool read_only,
             bool allow_exec, int crc);
   void init_oopmap(size_t offset, size_t size_in_bits);
@@ -217,6 +221,7 @@ class FileMapHeader: private CDSFileMapHeaderBase {
   bool   _verify_local;                 // BytecodeVerificationLocal setting
   bool   _verify_remote;                // BytecodeVerificationRemote setting
   bool   _has_platform_or_app_classes;  // Archive contains app classes
+  int    _app_class_path_crc;           // CRC of -Djava.class.path used during CDS dump
   char*  _requested_base_address;       // Archive relocation is not necessary if we map with this base address.
   char*  _mapped_base_address;          // Actual base address where archive is mapped.
 
@@ -263,6 +268,7 @@ class FileMapHeader: private CDSFileMapHeaderBase {
   char* mapped_base_address()              const { return _mapped_base_address; }
   bool has_platform_or_app_classes()       const { return _has_platform_or_app_classes; }
   bool has_non_jar_in_classpath()          const { return _has_non_jar_in_classpath; }
+  int app_class_path_crc()                 const { return _app_class_path_crc; }
   size_t ptrmap_size_in_bits()             const { return _ptrmap_size_in_bits; }
   bool compressed_oops()                   const { return _compressed_oops; }
   bool compressed_class_pointers()         const { return _compressed_class_ptrs; }
@@ -447,6 +453,7 @@ class FileMapInfo : public CHeapObj<mtInternal> {
   bool  has_heap_region()  NOT_CDS_JAVA_HEAP_RETURN_(false);
   MemRegion get_heap_region_requested_range() NOT_CDS_JAVA_HEAP_RETURN_(MemRegion());
   bool  read_region(int i, char* base, size_t size, bool do_commit);
+  bool  read_compressed_region(int i, char* base);
   char* map_bitmap_region();
   void  unmap_region(int i);
   void  close();
@@ -536,6 +543,7 @@ class FileMapInfo : public CHeapObj<mtInternal> {
                     GrowableArray<const char*>* rp_array,
                     unsigned int dumptime_prefix_len,
                     unsigned int runtime_prefix_len) NOT_CDS_RETURN_(false);
+  bool  same_app_class_path_strings(int num_paths, const char* appcp) NOT_CDS_RETURN_(false);
   bool  validate_boot_class_paths() NOT_CDS_RETURN_(false);
   bool  validate_app_class_paths(int shared_app_paths_len) NOT_CDS_RETURN_(false);
   bool  map_heap_region_impl() NOT_CDS_JAVA_HEAP_RETURN_(false);
@@ -29,6 +29,7 @@
 #include "cds/archiveUtils.hpp"
 #include "cds/cdsConfig.hpp"
 #include "cds/cdsHeapVerifier.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoaderData.hpp"
@@ -98,6 +99,10 @@ static const Klass* _test_class = nullptr;
 static const ArchivedKlassSubGraphInfoRecord* _test_class_record = nullptr;
 #endif
 
+// Classes specified by -XX:PreInitializeArchivedClasses that have been
+// initialized at dump time. See HeapShared::init_preinitialized_classes().
+GrowableArrayCHeap<InstanceKlass*, mtClassShared>* HeapShared::_preinitialized_classes = nullptr;
+
 
 //
 // If you add new entries to the following tables, you should know what you're doing!
@@ -148,7 +153,8 @@ static bool is_subgraph_root_class_of(ArchivableStaticFieldInfo fields[], Instan
 
 bool HeapShared::is_subgraph_root_class(InstanceKlass* ik) {
   return is_subgraph_root_class_of(archive_subgraph_entry_fields, ik) ||
-         is_subgraph_root_class_of(fmg_archive_subgraph_entry_fields, ik);
+         is_subgraph_root_class_of(fmg_archive_subgraph_entry_fields, ik) ||
+         ik->is_preinitialized();
 }
 
 unsigned HeapShared::oop_hash(oop const& p) {
@@ -526,6 +532,29 @@ bool HeapShared::initialize_enum_klass(InstanceKlass* k, TRAPS) {
   return true;
 }
 
+// See comments in HeapShared::prepare_preinitialized_classes()
+bool HeapShared::initialize_preinitialized_klass(InstanceKlass* k, TRAPS) {
+  if (!ArchiveHeapLoader::is_in_use()) {
+    return false;
+  }
+
+  // The primitive static fields are already set in the archived mirror. Load
+  // and initialize the classes of the archived objects before the reference
+  // fields are restored.
+  const ArchivedKlassSubGraphInfoRecord* record =
+    resolve_or_init_classes_for_subgraph_of(k, /*do_init=*/false, CHECK_false);
+  if (record == nullptr) {
+    return false;
+  }
+  if (log_is_enabled(Info, cds, heap)) {
+    ResourceMark rm;
+    log_info(cds, heap)("Initializing pre-initialized class: %s", k->external_name());
+  }
+  resolve_or_init_classes_for_subgraph_of(k, /*do_init=*/true, CHECK_false);
+  init_archived_fields_for(k, record);
+  return true;
+}
+
 void HeapShared::archive_objects(ArchiveHeapInfo *heap_info) {
   {
     NoSafepointVerifier nsv;
@@ -535,11 +564,17 @@ void HeapShared::archive_objects(ArchiveHeapInfo *heap_info) {
     // Cache for recording where the archived objects are copied to
     create_archived_object_cache();
 
-    log_info(cds)("Heap range = [" PTR_FORMAT " - "  PTR_FORMAT "]",
-                   UseCompressedOops ? p2i(CompressedOops::begin()) :
-                                       p2i((address)G1CollectedHeap::heap()->reserved().start()),
-                   UseCompressedOops ? p2i(CompressedOops::end()) :
-                                       p2i((address)G1CollectedHeap::heap()->reserved().end()));
+    if (UseCompressedOops) {
+      log_info(cds)("Heap range = [" PTR_FORMAT " - "  PTR_FORMAT "]",
+                    p2i(CompressedOops::begin()), p2i(CompressedOops::end()));
+    }
+#if INCLUDE_G1GC
+    else if (UseG1GC) {
+      log_info(cds)("Heap range = [" PTR_FORMAT " - "  PTR_FORMAT "]",
+                    p2i((address)G1CollectedHeap::heap()->reserved().start()),
+                    p2i((address)G1CollectedHeap::heap()->reserved().end()));
+    }
+#endif
     copy_objects();
 
     CDSHeapVerifier::verify();
@@ -577,6 +612,9 @@ void HeapShared::copy_special_objects() {
 void HeapShared::copy_objects() {
   assert(HeapShared::can_write(), "must be");
 
+  // Must be done before the scratch mirrors are archived by copy_special_objects().
+  prepare_preinitialized_classes();
+
   copy_interned_strings();
   copy_special_objects();
 
@@ -588,6 +626,8 @@ void HeapShared::copy_objects() {
                              true /* is_full_module_graph */);
     Modules::verify_archived_modules();
   }
+
+  archive_preinitialized_classes();
 }
 
 //
@@ -791,7 +831,10 @@ struct CopyKlassSubGraphInfoToArchive : StackObj {
   CopyKlassSubGraphInfoToArchive(CompactHashtableWriter* writer) : _writer(writer) {}
 
   bool do_entry(Klass* klass, KlassSubGraphInfo& info) {
-    if (info.subgraph_object_klasses() != nullptr || info.subgraph_entry_fields() != nullptr) {
+    // A pre-initialized class needs a record even if it has no reference static
+    // fields. See HeapShared::initialize_preinitialized_klass().
+    if (info.subgraph_object_klasses() != nullptr || info.subgraph_entry_fields() != nullptr ||
+        klass->is_preinitialized()) {
       ArchivedKlassSubGraphInfoRecord* record =
         (ArchivedKlassSubGraphInfoRecord*)ArchiveBuilder::ro_region_alloc(sizeof(ArchivedKlassSubGraphInfoRecord));
       record->init(&info);
@@ -928,6 +971,7 @@ void HeapShared::initialize_from_archived_subgraph(JavaThread* current, Klass* k
     return; // nothing to do
   }
 
+  CDSStatistics::PhaseTimer phase_timer(CDSStatistics::init_subgraphs);
   ExceptionMark em(THREAD);
   const ArchivedKlassSubGraphInfoRecord* record =
     resolve_or_init_classes_for_subgraph_of(k, /*do_init=*/true, THREAD);
@@ -1252,7 +1296,7 @@ void HeapShared::archive_reachable_objects_from_static_field(InstanceKlass *k,
                                                              int field_offset,
                                                              const char* field_name) {
   assert(CDSConfig::is_dumping_heap(), "dump time only");
-  assert(k->is_shared_boot_class(), "must be boot class");
+  assert(k->is_shared_boot_class() || k->is_preinitialized(), "must be boot class");
 
   oop m = k->java_mirror();
 
@@ -1303,7 +1347,7 @@ class VerifySharedOopClosure: public BasicOopIterateClosure {
 
 void HeapShared::verify_subgraph_from_static_field(InstanceKlass* k, int field_offset) {
   assert(CDSConfig::is_dumping_heap(), "dump time only");
-  assert(k->is_shared_boot_class(), "must be boot class");
+  assert(k->is_shared_boot_class() || k->is_preinitialized(), "must be boot class");
 
   oop m = k->java_mirror();
   oop f = m->obj_field(field_offset);
@@ -1584,6 +1628,276 @@ void HeapShared::init_for_dumping(TRAPS) {
     setup_test_class(ArchiveHeapTestClass);
     _dumped_interned_strings = new (mtClass)DumpedInternedStrings();
     init_subgraph_entry_fields(CHECK);
+    init_preinitialized_classes(CHECK);
+  }
+}
+
+// -XX:PreInitializeArchivedClasses=<list> names application classes whose static
+// state can be computed once, at dump time. Each class is initialized here, by
+// running its <clinit>. Later, when the heap is archived, the primitive static
+// fields are stored in the archived mirror and the objects reachable from the
+// reference static fields are archived as the subgraph of the class. At run time,
+// InstanceKlass::call_class_initializer() restores these fields instead of
+// running <clinit> (see HeapShared::initialize_preinitialized_klass()).
+//
+// It's up to the user to select classes whose <clinit> has no side effects
+// outside of the class's own static fields. We only reject the classes whose
+// state evidently cannot be restored this way.
+const char* HeapShared::check_preinitializable_class(InstanceKlass* ik) {
+  if (ik->is_hidden()) {
+    return "hidden class";
+  }
+  if (ik->is_interface()) {
+    return "interface";
+  }
+  if (!SystemDictionaryShared::is_builtin(ik)) {
+    return "not loaded by a built-in class loader";
+  }
+  if (ik->java_super() == vmClasses::Enum_klass()) {
+    return "enum class"; // archived by HeapShared::check_enum_obj()
+  }
+  InstanceKlass* super = ik->java_super();
+  if (super != vmClasses::Object_klass() && !_preinitialized_classes->contains(super)) {
+    // The super class would be initialized by running its <clinit>.
+    return "super class is not pre-initialized";
+  }
+  Array<InstanceKlass*>* interfaces = ik->transitive_interfaces();
+  for (int i = 0; i < interfaces->length(); i++) {
+    if (interfaces->at(i)->class_initializer() != nullptr) {
+      return "super interface has a static initializer";
+    }
+  }
+  for (JavaFieldStream fs(ik); !fs.done(); fs.next()) {
+    if (fs.access_flags().is_static() && !fs.access_flags().is_final()) {
+      return "has non-final static fields";
+    }
+  }
+  return nullptr;
+}
+
+void HeapShared::init_preinitialized_classes(TRAPS) {
+  if (PreInitializeArchivedClasses == nullptr || PreInitializeArchivedClasses[0] == '\0') {
+    return;
+  }
+  _preinitialized_classes = new GrowableArrayCHeap<InstanceKlass*, mtClassShared>();
+
+  ResourceMark rm(THREAD);
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  char* list = os::strdup_check_oom(PreInitializeArchivedClasses, mtClassShared);
+  char* save_ptr;
+  for (char* name = strtok_r(list, ",\n", &save_ptr); name != nullptr;
+       name = strtok_r(nullptr, ",\n", &save_ptr)) {
+    for (char* p = name; *p != '\0'; p++) {
+      if (*p == '.') {
+        *p = '/';
+      }
+    }
+    TempNewSymbol class_name = SymbolTable::new_symbol(name);
+    Klass* k = SystemDictionary::resolve_or_null(class_name, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      k = nullptr;
+    }
+    if (k == nullptr || !k->is_instance_klass()) {
+      log_warning(cds)("Cannot pre-initialize %s: class not found", name);
+      continue;
+    }
+
+    InstanceKlass* ik = InstanceKlass::cast(k);
+    const char* reason = check_preinitializable_class(ik);
+    if (reason != nullptr) {
+      log_warning(cds)("Cannot pre-initialize %s: %s", ik->external_name(), reason);
+      continue;
+    }
+
+    ik->initialize(THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      oop message = java_lang_Throwable::message(PENDING_EXCEPTION);
+      log_warning(cds)("Cannot pre-initialize %s: %s%s%s", ik->external_name(),
+                       PENDING_EXCEPTION->klass()->external_name(),
+                       message == nullptr ? "" : ": ",
+                       message == nullptr ? "" : java_lang_String::as_utf8_string(message));
+      CLEAR_PENDING_EXCEPTION;
+      continue;
+    }
+    _preinitialized_classes->append_if_missing(ik);
+  }
+  os::free(list);
+}
+
+// Checks that the objects reachable from the static fields of a pre-initialized
+// class can be archived as a subgraph of this class.
+class PreInitializedValueChecker : public BasicOopIterateClosure {
+  ResourceHashtable<oop, bool, 1031, AnyObj::RESOURCE_AREA, mtClassShared, HeapShared::oop_hash> _seen;
+  GrowableArray<oop> _stack;
+  const char* _reason;
+
+  template <class T> void do_oop_work(T* p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(obj)) {
+      push(obj);
+    }
+  }
+
+  void push(oop obj) {
+    bool created;
+    _seen.put_if_absent(obj, true, &created);
+    if (created) {
+      _stack.push(obj);
+    }
+  }
+
+  const char* check(oop obj) {
+    if (java_lang_Class::is_instance(obj)) {
+      return "references a java.lang.Class object";
+    }
+    if (!JavaClasses::is_supported_for_archiving(obj) || ArchiveHeapWriter::is_too_large_to_archive(obj)) {
+      return "references an object that cannot be archived";
+    }
+    Klass* k = obj->klass();
+    if (k->is_objArray_klass()) {
+      k = ObjArrayKlass::cast(k)->bottom_klass();
+    }
+    if (k->is_instance_klass()) {
+      InstanceKlass* ik = InstanceKlass::cast(k);
+      if (ik->module()->name() != vmSymbols::java_base()) {
+        // See KlassSubGraphInfo::check_allowed_klass()
+        return "references an object of a class outside of java.base";
+      }
+      if (ik->reference_type() != REF_NONE) {
+        return "references a java.lang.ref.Reference object";
+      }
+    }
+    return nullptr;
+  }
+
+public:
+  PreInitializedValueChecker() : _reason(nullptr) {}
+
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+  virtual void do_oop(      oop* p) { do_oop_work(p); }
+
+  // Returns the reason why the subgraph starting from root cannot be archived,
+  // or nullptr if it can be archived.
+  const char* check_subgraph(oop root) {
+    push(root);
+    while (_stack.is_nonempty()) {
+      oop obj = _stack.pop();
+      const char* reason = check(obj);
+      if (reason != nullptr) {
+        return reason;
+      }
+      obj->oop_iterate(this);
+    }
+    return nullptr;
+  }
+};
+
+static void copy_primitive_static_field(fieldDescriptor& fd, oop from, oop to) {
+  int offset = fd.offset();
+  switch (fd.field_type()) {
+  case T_BOOLEAN: to->bool_field_put(offset, from->bool_field(offset));     break;
+  case T_BYTE:    to->byte_field_put(offset, from->byte_field(offset));     break;
+  case T_CHAR:    to->char_field_put(offset, from->char_field(offset));     break;
+  case T_SHORT:   to->short_field_put(offset, from->short_field(offset));   break;
+  case T_INT:     to->int_field_put(offset, from->int_field(offset));       break;
+  case T_LONG:    to->long_field_put(offset, from->long_field(offset));     break;
+  case T_FLOAT:   to->float_field_put(offset, from->float_field(offset));   break;
+  case T_DOUBLE:  to->double_field_put(offset, from->double_field(offset)); break;
+  default:
+    ShouldNotReachHere();
+  }
+}
+
+// Called at the beginning of HeapShared::copy_objects(), before the scratch
+// mirrors are archived. For each class that has been initialized by
+// init_preinitialized_classes(), verify that all of its static state can be
+// archived, and copy its primitive static fields into its scratch mirror.
+// The reference static fields are archived by archive_preinitialized_classes().
+void HeapShared::prepare_preinitialized_classes() {
+  if (_preinitialized_classes == nullptr) {
+    return;
+  }
+
+  for (int i = 0; i < _preinitialized_classes->length(); i++) {
+    InstanceKlass* ik = _preinitialized_classes->at(i);
+    ResourceMark rm;
+    const char* reason = nullptr;
+    InstanceKlass* super = ik->java_super();
+    if (super != vmClasses::Object_klass() && !super->is_preinitialized()) {
+      reason = "super class is not pre-initialized";
+    } else {
+      MutexLocker ml(DumpTimeTable_lock, Mutex::_no_safepoint_check_flag);
+      if (SystemDictionaryShared::is_excluded_class(ik)) {
+        reason = "excluded from the archive";
+      }
+    }
+
+    oop mirror = ik->java_mirror();
+    for (JavaFieldStream fs(ik); !fs.done() && reason == nullptr; fs.next()) {
+      if (fs.access_flags().is_static()) {
+        fieldDescriptor& fd = fs.field_descriptor();
+        if (is_reference_type(fd.field_type())) {
+          oop v = mirror->obj_field(fd.offset());
+          if (v != nullptr) {
+            PreInitializedValueChecker checker;
+            reason = checker.check_subgraph(v);
+          }
+        }
+      }
+    }
+
+    if (reason != nullptr) {
+      log_warning(cds)("Cannot pre-initialize %s: %s", ik->external_name(), reason);
+      continue;
+    }
+
+    oop scratch_mirror = scratch_java_mirror(ik);
+    for (JavaFieldStream fs(ik); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static()) {
+        fieldDescriptor& fd = fs.field_descriptor();
+        if (!is_reference_type(fd.field_type())) {
+          copy_primitive_static_field(fd, mirror, scratch_mirror);
+        }
+      }
+    }
+
+    ik->set_is_preinitialized();
+    ArchiveBuilder::get_buffered_klass(ik)->set_is_preinitialized();
+    log_info(cds)("Pre-initialized %s", ik->external_name());
+  }
+}
+
+void HeapShared::archive_preinitialized_classes() {
+  if (_preinitialized_classes == nullptr) {
+    return;
+  }
+
+  for (int i = 0; i < _preinitialized_classes->length(); i++) {
+    InstanceKlass* ik = _preinitialized_classes->at(i);
+    if (!ik->is_preinitialized()) {
+      continue;
+    }
+    ResourceMark rm;
+    const char* klass_name = ik->external_name();
+    start_recording_subgraph(ik, klass_name, /*is_full_module_graph=*/false);
+    for (JavaFieldStream fs(ik); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static()) {
+        fieldDescriptor& fd = fs.field_descriptor();
+        if (is_reference_type(fd.field_type())) {
+          archive_reachable_objects_from_static_field(ik, klass_name, fd.offset(), fd.name()->as_C_string());
+        }
+      }
+    }
+    done_recording_subgraph(ik, klass_name);
+
+#ifndef PRODUCT
+    for (JavaFieldStream fs(ik); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static() && is_reference_type(fs.field_descriptor().field_type())) {
+        verify_subgraph_from_static_field(ik, fs.offset());
+      }
+    }
+#endif
   }
 }
 
@@ -143,13 +143,15 @@ class HeapShared: AllStatic {
   friend class VerifySharedOopClosure;
 
 public:
-  // Can this VM write a heap region into the CDS archive? Currently only G1+compressed{oops,cp}
+  // Can this VM write a heap region into the CDS archive? The archived objects are
+  // copied from the Java heap with raw accesses, so the collector must not move or
+  // color oops concurrently. Currently G1, Serial, Parallel or Epsilon + compressed cp.
   static bool can_write() {
     CDS_JAVA_HEAP_ONLY(
       if (_disable_writing) {
         return false;
       }
-      return (UseG1GC && UseCompressedClassPointers);
+      return ((UseG1GC || UseSerialGC || UseParallelGC || UseEpsilonGC) && UseCompressedClassPointers);
     )
     NOT_CDS_JAVA_HEAP(return false;)
   }
@@ -249,6 +251,13 @@ class HeapShared: AllStatic {
 
   static void verify_subgraph_from_static_field(
     InstanceKlass* k, int field_offset) PRODUCT_RETURN;
+
+  // -XX:PreInitializeArchivedClasses support
+  static GrowableArrayCHeap<InstanceKlass*, mtClassShared>* _preinitialized_classes;
+  static const char* check_preinitializable_class(InstanceKlass* ik);
+  static void init_preinitialized_classes(TRAPS);
+  static void prepare_preinitialized_classes();
+  static void archive_preinitialized_classes();
   static void verify_reachable_objects_from(oop obj) PRODUCT_RETURN;
   static void verify_subgraph_from(oop orig_obj) PRODUCT_RETURN;
   static void check_default_subgraph_classes();
@@ -415,6 +424,7 @@ class HeapShared: AllStatic {
   static void init_roots(oop roots_oop) NOT_CDS_JAVA_HEAP_RETURN;
   static void serialize_tables(SerializeClosure* soc) NOT_CDS_JAVA_HEAP_RETURN;
   static bool initialize_enum_klass(InstanceKlass* k, TRAPS) NOT_CDS_JAVA_HEAP_RETURN_(false);
+  static bool initialize_preinitialized_klass(InstanceKlass* k, TRAPS) NOT_CDS_JAVA_HEAP_RETURN_(false);
 
   static bool is_a_test_class_in_unnamed_module(Klass* ik) NOT_CDS_JAVA_HEAP_RETURN_(false);
 };
@@ -95,5 +95,6 @@ void RegeneratedClasses::cleanup() {
   }
   if (_renegerated_objs != nullptr) {
     delete _renegerated_objs;
+    _renegerated_objs = nullptr;
   }
 }
@@ -69,6 +69,19 @@
 // In this case the file name has additional compilation id "_compid%d"
 // because the method could be compiled several times.
 //
+// To capture compilations that are slow rather than crashing, the
+// CompileCommand option DumpReplaySlowerThan dumps the same file for every
+// compilation of the matching methods that takes at least the given number
+// of milliseconds:
+//
+// -XX:CompileCommand=DumpReplaySlowerThan,*.*,1000
+//
+// Similarly, the CompileCommand option DumpReplayLargerThan dumps the file for
+// every C1 or C2 compilation whose arena memory usage peaks at the given size
+// or more (see CompilationMemoryStatistic):
+//
+// -XX:CompileCommand=DumpReplayLargerThan,*.*,100m
+//
 // To replay compilation the replay file should be specified:
 //
 // -XX:+ReplayCompiles -XX:ReplayDataFile=replay_pid2133.log
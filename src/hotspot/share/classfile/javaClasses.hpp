@@ -169,6 +169,18 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    // Process four bytes per step to shorten the multiply dependency
+    // chain; 31^4 * h + 31^3 * b0 + 31^2 * b1 + 31 * b2 + b3 is the same
+    // value as four steps of the loop below. This is hot for SymbolTable.
+    while (len >= 4) {
+      h = 923521 * h +
+          29791 * (((unsigned int) s[0]) & 0xFF) +
+          961 * (((unsigned int) s[1]) & 0xFF) +
+          31 * (((unsigned int) s[2]) & 0xFF) +
+          (((unsigned int) s[3]) & 0xFF);
+      s += 4;
+      len -= 4;
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
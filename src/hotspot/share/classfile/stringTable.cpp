@@ -243,6 +243,10 @@ void StringTable::create_table() {
 #if INCLUDE_CDS_JAVA_HEAP
   if (ArchiveHeapLoader::is_in_use()) {
     _shared_strings_array = OopHandle(Universe::vm_global(), HeapShared::get_root(_shared_strings_array_root_index));
+  } else {
+    // The archived objects may have been disabled after the header of the shared table
+    // was read, if the streamed heap objects couldn't be materialized.
+    _shared_table.reset();
   }
 #endif
 }
@@ -400,6 +404,7 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      check_concurrent_work();
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -499,6 +504,18 @@ void StringTable::gc_notification(size_t num_dead) {
   }
 }
 
+// Growth is otherwise only considered after a GC reports dead strings,
+// so a burst of interning between GCs would leave the table overloaded.
+void StringTable::check_concurrent_work() {
+  if (has_work()) {
+    return;
+  }
+  if (should_grow()) {
+    log_debug(stringtable)("Concurrent work triggered, live factor: %g", get_load_factor());
+    trigger_concurrent_work();
+  }
+}
+
 bool StringTable::has_work() {
   return Atomic::load_acquire(&_has_work);
 }
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/cdsConfig.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "cds/heapShared.hpp"
 #include "classfile/classFileParser.hpp"
 #include "classfile/classFileStream.hpp"
@@ -1172,6 +1173,7 @@ InstanceKlass* SystemDictionary::load_shared_class(InstanceKlass* ik,
     ObjectLocker ol(lockObject, THREAD);
     // prohibited package check assumes all classes loaded from archive call
     // restore_unshareable_info which calls ik->set_package()
+    CDSStatistics::PhaseTimer phase_timer(CDSStatistics::restore_classes);
     ik->restore_unshareable_info(loader_data, protection_domain, pkg_entry, CHECK_NULL);
   }
 
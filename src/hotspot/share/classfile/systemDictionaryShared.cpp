@@ -568,10 +568,10 @@ void SystemDictionaryShared::validate_before_archiving(InstanceKlass* k) {
   assert(!class_loading_may_happen(), "class loading must be disabled");
   guarantee(info != nullptr, "Class %s must be entered into _dumptime_table", name);
   guarantee(!info->is_excluded(), "Should not attempt to archive excluded class %s", name);
+  if (k->is_hidden()) {
+    assert(is_registered_lambda_proxy_class(k), "unexpected hidden class %s", name);
+  }
   if (is_builtin(k)) {
-    if (k->is_hidden()) {
-      assert(is_registered_lambda_proxy_class(k), "unexpected hidden class %s", name);
-    }
     guarantee(!k->is_shared_unregistered_class(),
               "Class loader type must be set for BUILTIN class %s", name);
 
@@ -588,7 +588,9 @@ class UnregisteredClassesDuplicationChecker : StackObj {
   UnregisteredClassesDuplicationChecker() : _thread(Thread::current()) {}
 
   void do_entry(InstanceKlass* k, DumpTimeClassInfo& info) {
-    if (!SystemDictionaryShared::is_builtin(k)) {
+    // Lambda proxy classes are not in the unregistered dictionary. They are
+    // excluded together with their caller classes.
+    if (!SystemDictionaryShared::is_builtin(k) && !k->is_hidden()) {
       _list.append(k);
     }
   }
@@ -760,8 +762,11 @@ void SystemDictionaryShared::add_lambda_proxy_class(InstanceKlass* caller_ik,
   InstanceKlass* nest_host = caller_ik->nest_host(CHECK);
   assert(nest_host != nullptr, "unexpected nullptr nest_host");
 
+  // The lambda proxy classes of unregistered classes (loaded by custom class loaders)
+  // are archived as well. Both classes have the same loader, so the lambda proxy class
+  // is in the same (builtin or unregistered) category as its caller.
   DumpTimeClassInfo* info = _dumptime_table->get(lambda_ik);
-  if (info != nullptr && !lambda_ik->is_non_strong_hidden() && is_builtin(lambda_ik) && is_builtin(caller_ik)
+  if (info != nullptr && !lambda_ik->is_non_strong_hidden()
       // Don't include the lambda proxy if its nest host is not in the "linked" state.
       && nest_host->is_linked()) {
     // Set _is_archived_lambda_proxy in DumpTimeClassInfo so that the lambda_ik
@@ -851,7 +856,10 @@ InstanceKlass* SystemDictionaryShared::prepare_shared_lambda_proxy_class(Instanc
   Handle class_loader(THREAD, caller_ik->class_loader());
   Handle protection_domain;
   PackageEntry* pkg_entry = caller_ik->package();
-  if (caller_ik->class_loader() != nullptr) {
+  if (caller_ik->is_shared_unregistered_class()) {
+    // The custom loader has given the caller class its protection domain.
+    protection_domain = Handle(THREAD, java_lang_Class::protection_domain(caller_ik->java_mirror()));
+  } else if (caller_ik->class_loader() != nullptr) {
     protection_domain = CDSProtectionDomain::init_security_info(class_loader, caller_ik, pkg_entry, CHECK_NULL);
   }
 
@@ -1222,8 +1230,8 @@ class CopySharedClassInfoToArchive : StackObj {
       name = ArchiveBuilder::current()->get_buffered_addr(name);
       hash = SystemDictionaryShared::hash_for_shared_dictionary((address)name);
       u4 delta = _builder->buffer_to_offset_u4((address)record);
-      if (_is_builtin && info._klass->is_hidden()) {
-        // skip
+      if (info._klass->is_hidden()) {
+        // Lambda proxy classes are looked up with the lambda proxy class dictionary
       } else {
         _writer->add(hash, delta);
       }
@@ -1348,6 +1356,24 @@ void SystemDictionaryShared::update_shared_entry(InstanceKlass* k, int id) {
   info->_id = id;
 }
 
+// Called for the "@class-init" lines of the classlist, in the order they appear.
+// See ArchiveBuilder::sort_klasses().
+void SystemDictionaryShared::record_class_init_order(InstanceKlass* k) {
+  assert(DumpSharedSpaces, "supported only when dumping");
+  static int next_order = 0;
+  DumpTimeClassInfo* info = get_info(k);
+  if (info->_init_order < 0) {
+    info->_init_order = next_order++;
+  }
+}
+
+// Returns -1 if k was not initialized during the training run.
+int SystemDictionaryShared::class_init_order(InstanceKlass* k) {
+  MutexLocker ml(DumpTimeTable_lock, Mutex::_no_safepoint_check_flag);
+  DumpTimeClassInfo* info = _dumptime_table->get(k);
+  return (info != nullptr) ? info->_init_order : -1;
+}
+
 const char* class_loader_name_for_shared(Klass* k) {
   assert(k != nullptr, "Sanity");
   assert(k->is_shared(), "Must be");
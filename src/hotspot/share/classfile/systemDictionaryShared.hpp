@@ -239,6 +239,8 @@ class SystemDictionaryShared: public SystemDictionary {
   }
 
   static void update_shared_entry(InstanceKlass* klass, int id);
+  static void record_class_init_order(InstanceKlass* klass);
+  static int  class_init_order(InstanceKlass* klass);
   static void set_shared_class_misc_info(InstanceKlass* k, ClassFileStream* cfs);
 
   static InstanceKlass* lookup_from_stream(Symbol* class_name,
@@ -1432,15 +1432,18 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+int CodeCache::make_marked_nmethods_deoptimized() {
+  int count = 0;
   RelaxedCompiledMethodIterator iter(RelaxedCompiledMethodIterator::only_not_unloading);
   while(iter.next()) {
     CompiledMethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
+      count++;
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1834,6 +1837,33 @@ void CodeCache::print_layout(outputStream* st) {
   print_summary(st, true);
 }
 
+// Same information as print_layout, as a single JSON object for tools that
+// poll it. Only per-heap counters are read, so the lock is held briefly.
+void CodeCache::print_layout_json(outputStream* st) {
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  st->print("{\"heaps\":[");
+  bool first = true;
+  FOR_ALL_HEAPS(heap_iterator) {
+    CodeHeap* heap = (*heap_iterator);
+    size_t total = (heap->high_boundary() - heap->low_boundary());
+    st->print("%s{\"name\":\"%s\",\"size\":" SIZE_FORMAT ",\"used\":" SIZE_FORMAT
+              ",\"max_used\":" SIZE_FORMAT ",\"free\":" SIZE_FORMAT ",\"full_count\":%d}",
+              first ? "" : ",", heap->name(), total, total - heap->unallocated_capacity(),
+              heap->max_allocated_capacity(), heap->unallocated_capacity(),
+              get_codemem_full_count(heap->code_blob_type()));
+    first = false;
+  }
+  st->print("],\"total_blobs\":" UINT32_FORMAT ",\"nmethods\":" UINT32_FORMAT
+            ",\"adapters\":" UINT32_FORMAT, blob_count(), nmethod_count(), adapter_count());
+  st->print(",\"compilation_enabled\":%s,\"stopped_count\":%d,\"restarted_count\":%d",
+            CompileBroker::should_compile_new_jobs() ? "true" : "false",
+            CompileBroker::get_total_compiler_stopped_count(),
+            CompileBroker::get_total_compiler_restarted_count());
+  st->print_cr(",\"queue_sizes\":{\"c1\":%d,\"c2\":%d}}",
+               CompileBroker::queue_size(CompLevel_simple),
+               CompileBroker::queue_size(CompLevel_full_optimization));
+}
+
 void CodeCache::log_state(outputStream* st) {
   st->print(" total_blobs='" UINT32_FORMAT "' nmethods='" UINT32_FORMAT "'"
             " adapters='" UINT32_FORMAT "' free_code_cache='" SIZE_FORMAT "'",
@@ -236,6 +236,7 @@ class CodeCache : AllStatic {
   // Dcmd (Diagnostic commands)
   static void print_codelist(outputStream* st);
   static void print_layout(outputStream* st);
+  static void print_layout_json(outputStream* st);
 
   // The full limits of the codeCache
   static address low_bound()                          { return _low_bound; }
@@ -305,7 +306,8 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization(DeoptimizationScope* deopt_scope);
   static void mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method* dependee);
-  static void make_marked_nmethods_deoptimized();
+  // Returns the number of compiled methods made not entrant
+  static int make_marked_nmethods_deoptimized();
 
   // Marks dependents during classloading
   static void mark_dependents_on(DeoptimizationScope* deopt_scope, InstanceKlass* dependee);
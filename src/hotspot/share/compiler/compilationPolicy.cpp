@@ -109,6 +109,49 @@ void CompilationPolicy::compile_if_required(const methodHandle& m, TRAPS) {
   }
 }
 
+void CompilationPolicy::compile_archived_methods(InstanceKlass* ik, JavaThread* current) {
+  assert(ik->is_shared() && ik->is_initialized(), "sanity");
+  ExceptionMark em(current);
+  JavaThread* THREAD = current; // For exception macros.
+  if (!THREAD->can_call_java() || !is_compilation_enabled()) {
+    return;
+  }
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    Method* m = methods->at(i);
+    methodHandle mh(THREAD, m);
+    CompLevel level;
+    if (m->has_archived_c2_compilation()) {
+      // The profile of the training run is not archived, and C2 code compiled without
+      // a profile would be based on guesses and likely deoptimize. Unless the method
+      // has been profiled already, start at the initial level (CompLevel_full_profile
+      // in the normal mode), so that the usual transition to C2 uses the profile
+      // collected by this run.
+      level = (m->method_data() != nullptr) ? CompLevel_full_optimization : initial_compile_level(mh);
+    } else if (m->has_archived_c1_compilation()) {
+      level = CompLevel_simple;
+    } else {
+      continue;
+    }
+    level = limit_level(level);
+    if (level == CompLevel_none || mh->code() != nullptr || !can_be_compiled(mh, level) ||
+        CompileBroker::compilation_is_in_queue(mh)) {
+      // The holder may have been initialized after the method was already compiled
+      // through the usual profiling path.
+      continue;
+    }
+    if (PrintTieredEvents) {
+      print_event(COMPILE, m, m, InvocationEntryBci, level);
+    }
+    CompileBroker::compile_method(mh, InvocationEntryBci, level, methodHandle(), 0, CompileTask::Reason_Archived, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // This is only a hint, the methods will be compiled later through the usual path.
+      CLEAR_PENDING_EXCEPTION;
+      return;
+    }
+  }
+}
+
 static inline CompLevel adjust_level_for_compilability_query(CompLevel comp_level) {
   if (comp_level == CompLevel_any) {
      if (CompilerConfig::is_c1_only()) {
@@ -624,6 +667,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -646,14 +690,14 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
+    if (max_task == nullptr || compare_tasks(task, max_task, now)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == nullptr || compare_tasks(task, max_blocking_task, now)) {
         max_blocking_task = task;
       }
     }
@@ -877,18 +921,27 @@ double CompilationPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
-// Apply heuristics and return true if x should be compiled before y
-bool CompilationPolicy::compare_methods(Method* x, Method* y) {
-  if (x->highest_comp_level() > y->highest_comp_level()) {
+// The weight of a task grows linearly with the time it has spent in the queue,
+// gaining its base weight again every TieredCompileTaskAgingPeriod milliseconds.
+// This keeps a steady stream of hot methods from starving lukewarm ones.
+double CompilationPolicy::task_weight(CompileTask* task, jlong now) {
+  double w = weight(task->method());
+  if (TieredCompileTaskAgingPeriod > 0) {
+    double waited = TimeHelper::counter_to_millis(now - task->time_queued());
+    w *= 1.0 + waited / TieredCompileTaskAgingPeriod;
+  }
+  return w;
+}
+
+// Apply heuristics and return true if task x should be compiled before task y
+bool CompilationPolicy::compare_tasks(CompileTask* x, CompileTask* y, jlong now) {
+  Method* mx = x->method();
+  Method* my = y->method();
+  if (mx->highest_comp_level() != my->highest_comp_level()) {
     // recompilation after deopt
-    return true;
-  } else
-    if (x->highest_comp_level() == y->highest_comp_level()) {
-      if (weight(x) > weight(y)) {
-        return true;
-      }
-    }
-  return false;
+    return mx->highest_comp_level() > my->highest_comp_level();
+  }
+  return task_weight(x, now) > task_weight(y, now);
 }
 
 // Is method profiled enough?
@@ -203,8 +203,10 @@ class CompilationPolicy : AllStatic {
   inline static bool is_stale(jlong t, jlong timeout, const methodHandle& method);
   // Compute the weight of the method for the compilation scheduling
   inline static double weight(Method* method);
-  // Apply heuristics and return true if x should be compiled before y
-  inline static bool compare_methods(Method* x, Method* y);
+  // Compute the weight of a queued task, boosted by how long it has been waiting
+  inline static double task_weight(CompileTask* task, jlong now);
+  // Apply heuristics and return true if task x should be compiled before task y
+  inline static bool compare_tasks(CompileTask* x, CompileTask* y, jlong now);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, const methodHandle& method);
@@ -255,6 +257,10 @@ class CompilationPolicy : AllStatic {
   // This supports the -Xcomp option.
   static void compile_if_required(const methodHandle& m, TRAPS);
 
+  // Request compilation of the methods of the shared class ik that were compiled
+  // during the CDS training run. This supports the -XX:+ArchiveCompilations option.
+  static void compile_archived_methods(InstanceKlass* ik, JavaThread* current);
+
   // m is allowed to be compiled
   static bool can_be_compiled(const methodHandle& m, int comp_level = CompLevel_any);
   // m is allowed to be osr compiled
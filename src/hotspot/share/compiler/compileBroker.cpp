@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/classListWriter.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/vmClasses.hpp"
@@ -440,12 +441,33 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
     save_hot_method = methodHandle(thread, task->hot_method());
 
+    record_wait(task);
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
 }
 
+// Fold the queueing time of a task that is about to be compiled into
+// the average wait of this queue.
+void CompileQueue::record_wait(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  jlong waited = os::elapsed_counter() - task->time_queued();
+  _average_wait = (3 * _average_wait + waited) / 4;
+}
+
+// The average wait of the recently dequeued tasks, or the time the task at the
+// head of the queue has been waiting so far, whichever is longer. The latter
+// reflects a backlog even before its tasks are dequeued.
+double CompileQueue::wait_millis() {
+  MutexLocker locker(MethodCompileQueue_lock);
+  jlong wait = _average_wait;
+  if (_first != nullptr) {
+    wait = MAX2(wait, os::elapsed_counter() - _first->time_queued());
+  }
+  return TimeHelper::counter_to_millis(wait);
+}
+
 // Clean & deallocate stale compile tasks.
 // Temporarily releases MethodCompileQueue lock.
 void CompileQueue::purge_stale_tasks() {
@@ -651,7 +673,7 @@ void CompileBroker::compilation_init(JavaThread* THREAD) {
    }
 #endif // INCLUDE_JVMCI
 
-  if (CompilerOracle::should_collect_memstat()) {
+  if (CompilerOracle::should_collect_memstat() || CompilerMemoryLimit > 0) {
     CompilationMemoryStatistic::initialize();
   }
 
@@ -1010,6 +1032,20 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+// With a CompilerThreadQueueWaitTarget, only grow while tasks wait longer
+// than the target, one thread at a time, and never beyond half of the
+// processors available to the VM (which follows the container CPU quota).
+static int limit_by_queue_wait(double wait_millis, int old_count, int new_count) {
+  if (CompilerThreadQueueWaitTarget == 0 || new_count <= old_count) {
+    return new_count;
+  }
+  if (wait_millis <= (double)CompilerThreadQueueWaitTarget) {
+    return old_count;
+  }
+  int cpu_limit = MAX2(1, os::active_processor_count() / 2);
+  return MAX2(old_count, MIN2(old_count + 1, cpu_limit));
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
@@ -1017,6 +1053,15 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // Read the queue waits before taking CompileThread_lock, which ranks the same
+  // as MethodCompileQueue_lock.
+  double c2_wait = 0.0;
+  double c1_wait = 0.0;
+  if (CompilerThreadQueueWaitTarget > 0) {
+    c2_wait = (_c2_compile_queue != nullptr) ? _c2_compile_queue->wait_millis() : 0.0;
+    c1_wait = (_c1_compile_queue != nullptr) ? _c1_compile_queue->wait_millis() : 0.0;
+  }
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
@@ -1026,6 +1071,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = limit_by_queue_wait(c2_wait, old_c2_count, new_c2_count);
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1084,6 +1130,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = limit_by_queue_wait(c1_wait, old_c1_count, new_c1_count);
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -1867,6 +1914,9 @@ CompileLog* CompileBroker::get_log(CompilerThread* ct) {
   return log;
 }
 
+// Index used to distribute compiler threads over NUMA nodes.
+static volatile uint _compiler_thread_placement_index = 0;
+
 // ------------------------------------------------------------------
 // CompileBroker::compiler_thread_loop
 //
@@ -1878,6 +1928,8 @@ void CompileBroker::compiler_thread_loop() {
   // this resource mark holds all the shared objects
   ResourceMark rm;
 
+  os::numa_place_current_thread(Atomic::fetch_then_add(&_compiler_thread_placement_index, 1u));
+
   // First thread to get here will initialize the compiler interface
 
   {
@@ -2117,6 +2169,18 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->num_inlined_bytecodes());
 }
 
+static void post_queue_wait_event(EventCompilationQueueWait& event, CompileTask* task) {
+  assert(task != nullptr, "invariant");
+  jlong waited = os::elapsed_counter() - task->time_queued();
+  CompilerEvent::QueueWaitEvent::post(event,
+                                      task->compile_id(),
+                                      task->compiler()->type(),
+                                      task->method(),
+                                      task->comp_level(),
+                                      task->osr_bci() != CompileBroker::standard_entry_bci,
+                                      (jlong)(TimeHelper::counter_to_seconds(waited) * NANOSECS_PER_SEC));
+}
+
 int DirectivesStack::_depth = 0;
 CompilerDirectives* DirectivesStack::_top = nullptr;
 CompilerDirectives* DirectivesStack::_bottom = nullptr;
@@ -2148,6 +2212,13 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   CompilerThread* thread = CompilerThread::current();
   ResourceMark rm(thread);
 
+  {
+    EventCompilationQueueWait event;
+    if (event.should_commit()) {
+      post_queue_wait_event(event, task);
+    }
+  }
+
   if (CompilationLog::log() != nullptr) {
     CompilationLog::log()->log_compile(thread, task);
   }
@@ -2289,8 +2360,21 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       if (WhiteBoxAPI && WhiteBox::compilation_locked) {
         whitebox_lock_compilation();
       }
+      jlong start_nanos = os::javaTimeNanos();
       comp->compile_method(&ci_env, target, osr_bci, true, directive);
 
+      // Capture slow or memory-heavy compilations so that they can be replayed offline.
+      // The arena peak of C1 and C2 compilations is recorded by CompilationMemoryStatistic,
+      // which DumpReplayLargerThan enables.
+      intx slow_threshold = directive->DumpReplaySlowerThanOption;
+      intx large_threshold = directive->DumpReplayLargerThanOption;
+      bool is_slow = slow_threshold > 0 && nanos_to_millis(os::javaTimeNanos() - start_nanos) >= slow_threshold;
+      bool is_large = large_threshold > 0 && (comp->is_c1() || comp->is_c2()) && thread->arena_stat() != nullptr &&
+                      thread->arena_stat()->peak_since_start() >= (size_t)large_threshold;
+      if (is_slow || is_large) {
+        ci_env.dump_replay_data(compile_id);
+      }
+
       /* Repeat compilation without installing code for profiling purposes */
       int repeat_compilation_count = directive->RepeatCompilationOption;
       while (repeat_compilation_count > 0) {
@@ -2347,6 +2431,10 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  if (task->is_success() && !is_osr && ClassListWriter::is_enabled()) {
+    ClassListWriter::write_compiled_method(method(), task_level);
+  }
+
   if (PrintCompilation && PrintCompilation2) {
     tty->print("%7d ", (int) tty->time_stamp().milliseconds());  // print timestamp
     tty->print("%4d ", compile_id);    // print compilation number
@@ -89,7 +89,11 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Decaying average of the time tasks waited in this queue, in elapsed counter ticks
+  jlong _average_wait;
+
   void purge_stale_tasks();
+  void record_wait(CompileTask* task);
  public:
   CompileQueue(const char* name) {
     _name = name;
@@ -97,6 +101,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _last = nullptr;
     _size = 0;
     _first_stale = nullptr;
+    _average_wait = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -111,6 +116,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   bool         is_empty() const                  { return _first == nullptr; }
   int          size()     const                  { return _size;          }
+  double       wait_millis();
 
 
   // Redefine Classes support
@@ -203,8 +203,8 @@ bool DirectiveSet::is_c2(CompilerDirectives* directive) const {
 }
 
 bool DirectiveSet::should_collect_memstat() const {
-  // MemLimit requires the memory statistic to be active
-  return MemStatOption > 0 || MemLimitOption != 0;
+  // MemLimit and DumpReplayLargerThan require the memory statistic to be active
+  return MemStatOption > 0 || MemLimitOption != 0 || DumpReplayLargerThanOption > 0;
 }
 
 bool DirectiveSet::should_print_memstat() const {
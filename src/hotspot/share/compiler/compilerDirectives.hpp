@@ -41,7 +41,7 @@
     cflags(BreakAtExecute,          bool, false, BreakAtExecute) \
     cflags(BreakAtCompile,          bool, false, BreakAtCompile) \
     cflags(Log,                     bool, LogCompilation, Unknown) \
-    cflags(MemLimit,                intx, 0, MemLimit) \
+    cflags(MemLimit,                intx, CompilerMemoryLimit, MemLimit) \
     cflags(MemStat,                 uintx, 0, MemStat) \
     cflags(PrintAssembly,           bool, PrintAssembly, PrintAssembly) \
     cflags(PrintCompilation,        bool, PrintCompilation, PrintCompilation) \
@@ -50,6 +50,8 @@
     cflags(BackgroundCompilation,   bool, BackgroundCompilation, BackgroundCompilation) \
     cflags(ReplayInline,            bool, false, ReplayInline) \
     cflags(DumpReplay,              bool, false, DumpReplay) \
+    cflags(DumpReplaySlowerThan,    intx, 0, DumpReplaySlowerThan) \
+    cflags(DumpReplayLargerThan,    intx, 0, DumpReplayLargerThan) \
     cflags(DumpInline,              bool, false, DumpInline) \
     cflags(CompilerDirectivesIgnoreCompileCommands, bool, CompilerDirectivesIgnoreCompileCommands, Unknown) \
     cflags(RepeatCompilation,       intx, RepeatCompilation, RepeatCompilation)
@@ -146,6 +146,16 @@ void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_
   commit(event);
 }
 
+void CompilerEvent::QueueWaitEvent::post(EventCompilationQueueWait& event, int compile_id, CompilerType compiler_type, Method* method, int compile_level, bool is_osr, jlong queue_time_ns) {
+  event.set_compileId(compile_id);
+  event.set_compiler(compiler_type);
+  event.set_method(method);
+  event.set_compileLevel((short)compile_level);
+  event.set_isOsr(is_osr);
+  event.set_queueTime(queue_time_ns);
+  commit(event);
+}
+
 void CompilerEvent::CompilationFailureEvent::post(EventCompilationFailure& event, int compile_id, const char* reason) {
   event.set_compileId(compile_id);
   event.set_failureMessage(reason);
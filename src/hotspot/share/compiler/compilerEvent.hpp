@@ -39,6 +39,7 @@ class GrowableArray;
 class Method;
 class EventCompilation;
 class EventCompilationFailure;
+class EventCompilationQueueWait;
 class EventCompilerInlining;
 class EventCompilerPhase;
 struct JfrStructCalleeMethod;
@@ -55,6 +56,11 @@ class CompilerEvent : AllStatic {
     static void post(EventCompilation& event, int compile_id, CompilerType type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes) NOT_JFR_RETURN();
   };
 
+  class QueueWaitEvent : AllStatic {
+   public:
+    static void post(EventCompilationQueueWait& event, int compile_id, CompilerType type, Method* method, int compile_level, bool is_osr, jlong queue_time_ns) NOT_JFR_RETURN();
+  };
+
   class CompilationFailureEvent : AllStatic {
    public:
     static void post(EventCompilationFailure& event, int compile_id, const char* reason) NOT_JFR_RETURN();
@@ -460,7 +460,8 @@ bool CompilerOracle::should_print_methods() {
 
 // Tells whether there are any methods to collect memory statistics for
 bool CompilerOracle::should_collect_memstat() {
-  return has_command(CompileCommand::MemStat) || has_command(CompileCommand::MemLimit);
+  return has_command(CompileCommand::MemStat) || has_command(CompileCommand::MemLimit) ||
+         has_command(CompileCommand::DumpReplayLargerThan);
 }
 
 bool CompilerOracle::should_print_final_memstat_report() {
@@ -673,6 +674,22 @@ static bool parseMemLimit(const char* line, intx& value, int& bytes_read, char*
   return true;
 }
 
+static bool parseMemSize(const char* line, intx& value, int& bytes_read, char* errorbuf, const int buf_size) {
+  // Format:
+  // "<memory size>", which can have units, e.g. M
+  //
+  // Example:
+  // -XX:CompileCommand='DumpReplayLargerThan,*.*,100m'
+  size_t s = 0;
+  char* end;
+  if (!parse_integer<size_t>(line, &end, &s)) {
+    jio_snprintf(errorbuf, buf_size, "%s: invalid value", option2name(CompileCommand::DumpReplayLargerThan));
+  }
+  bytes_read = (int)(end - line);
+  value = (intx)s;
+  return true;
+}
+
 static bool parseEnumValueAsUintx(enum CompileCommand option, const char* line, uintx& value, int& bytes_read, char* errorbuf, const int buf_size) {
   if (option == CompileCommand::MemStat) {
     if (strncasecmp(line, "collect", 7) == 0) {
@@ -700,6 +717,10 @@ static void scan_value(enum OptionType type, char* line, int& total_bytes_read,
     intx value;
     // Special handling for memlimit
     bool success = (option == CompileCommand::MemLimit) && parseMemLimit(line, value, bytes_read, errorbuf, buf_size);
+    if (!success) {
+      // Special handling for the memory size in DumpReplayLargerThan
+      success = (option == CompileCommand::DumpReplayLargerThan) && parseMemSize(line, value, bytes_read, errorbuf, buf_size);
+    }
     if (!success) {
       // Is it a raw number?
       success = sscanf(line, "" INTX_FORMAT "%n", &value, &bytes_read) == 1;
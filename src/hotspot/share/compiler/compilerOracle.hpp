@@ -72,6 +72,8 @@ class methodHandle;
   option(RepeatCompilation, "RepeatCompilation", Intx) \
   option(ReplayInline,   "ReplayInline", Bool) \
   option(DumpReplay,     "DumpReplay", Bool) \
+  option(DumpReplaySlowerThan, "DumpReplaySlowerThan", Intx) \
+  option(DumpReplayLargerThan, "DumpReplayLargerThan", Intx) \
   option(DumpInline,     "DumpInline", Bool) \
   option(CompileThresholdScaling, "CompileThresholdScaling", Double) \
   option(ControlIntrinsic,  "ControlIntrinsic",  Ccstrlist) \
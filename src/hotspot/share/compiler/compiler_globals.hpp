@@ -248,6 +248,11 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskAgingPeriod, 0, EXPERIMENTAL,              \
+          "Add the base scheduling weight of a queued compile task again "  \
+          "every given number of milliseconds it waits (0 = no aging)")     \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -379,6 +384,13 @@
           "Don't compile methods larger than this if "                      \
           "+DontCompileHugeMethods")                                        \
                                                                             \
+  product(intx, CompilerMemoryLimit, 0, EXPERIMENTAL,                       \
+          "Default limit, in bytes, for the arena memory used by a single " \
+          "compilation. Compilations exceeding it bail out and the method " \
+          "is no longer compiled at that tier. Per-method MemLimit "        \
+          "compile commands take precedence. 0 means no limit")             \
+          range(0, max_intx)                                                \
+                                                                            \
 
 // end of COMPILER_FLAGS
 
@@ -74,6 +74,8 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _concurrent_mark_cleanup_times_ms(NumPrevPausesForHeuristics),
     _alloc_rate_ms_seq(TruncatedSeqLength),
     _prev_collection_pause_end_ms(0.0),
+    _alloc_rate_level_ms(0.0),
+    _alloc_rate_trend_ms(0.0),
     _concurrent_refine_rate_ms_seq(TruncatedSeqLength),
     _dirtied_cards_rate_ms_seq(TruncatedSeqLength),
     _dirtied_cards_in_thread_buffers_seq(TruncatedSeqLength),
@@ -154,7 +156,23 @@ void G1Analytics::report_concurrent_mark_remark_times_ms(double ms) {
   _concurrent_mark_remark_times_ms.add(ms);
 }
 
+// Smoothing factors for the level and the trend of the allocation rate forecast.
+// The level follows new samples quickly; the trend is damped so that a single
+// outlier does not cause a large extrapolation.
+static const double alloc_rate_level_weight = 0.5;
+static const double alloc_rate_trend_weight = 0.3;
+
 void G1Analytics::report_alloc_rate_ms(double alloc_rate) {
+  if (_alloc_rate_ms_seq.num() == 0) {
+    _alloc_rate_level_ms = alloc_rate;
+    _alloc_rate_trend_ms = 0.0;
+  } else {
+    double prev_level = _alloc_rate_level_ms;
+    _alloc_rate_level_ms = alloc_rate_level_weight * alloc_rate +
+                           (1.0 - alloc_rate_level_weight) * (prev_level + _alloc_rate_trend_ms);
+    _alloc_rate_trend_ms = alloc_rate_trend_weight * (_alloc_rate_level_ms - prev_level) +
+                           (1.0 - alloc_rate_trend_weight) * _alloc_rate_trend_ms;
+  }
   _alloc_rate_ms_seq.add(alloc_rate);
 }
 
@@ -233,6 +251,14 @@ double G1Analytics::predict_alloc_rate_ms() const {
   }
 }
 
+double G1Analytics::forecast_alloc_rate_ms() const {
+  if (enough_samples_available(&_alloc_rate_ms_seq)) {
+    return MAX2(_alloc_rate_level_ms + _alloc_rate_trend_ms, 0.0);
+  } else {
+    return 0.0;
+  }
+}
+
 double G1Analytics::predict_concurrent_refine_rate_ms() const {
   return predict_zero_bounded(&_concurrent_refine_rate_ms_seq);
 }
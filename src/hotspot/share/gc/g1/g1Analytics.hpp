@@ -46,6 +46,13 @@ class G1Analytics: public CHeapObj<mtGC> {
   TruncatedSeq _alloc_rate_ms_seq;
   double        _prev_collection_pause_end_ms;
 
+  // Double exponentially smoothed level and trend of the allocation rate in
+  // regions/ms. Unlike _alloc_rate_ms_seq, which only reacts to a rising
+  // allocation rate after it has been observed for a few pauses, the trend
+  // extrapolates it one mutator interval ahead.
+  double _alloc_rate_level_ms;
+  double _alloc_rate_trend_ms;
+
   TruncatedSeq _concurrent_refine_rate_ms_seq;
   TruncatedSeq _dirtied_cards_rate_ms_seq;
   TruncatedSeq _dirtied_cards_in_thread_buffers_seq;
@@ -141,6 +148,9 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_code_root_rs_length(double code_root_rs_length, bool for_young_only_phase);
 
   double predict_alloc_rate_ms() const;
+  // Allocation rate expected during the next mutator interval, following the
+  // recent trend. Returns 0.0 while there are not enough samples.
+  double forecast_alloc_rate_ms() const;
   int num_alloc_rate_ms() const;
 
   double predict_concurrent_refine_rate_ms() const;
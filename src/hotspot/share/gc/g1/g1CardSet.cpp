@@ -64,6 +64,13 @@ static uint default_log2_card_regions_per_region() {
   return log2_card_regions_per_heap_region;
 }
 
+// Small arrays of cards hold a quarter of the cards of a full sized array. They
+// are not used if that is not more than what an inline pointer already holds.
+static uint small_array_size(uint max_cards_in_array, uint max_cards_in_inline_ptr) {
+  uint const small_array_cards = max_cards_in_array / 4;
+  return small_array_cards > max_cards_in_inline_ptr ? small_array_cards : max_cards_in_array;
+}
+
 G1CardSetConfiguration::G1CardSetConfiguration() :
   G1CardSetConfiguration(HeapRegion::LogCardsPerRegion - default_log2_card_regions_per_region(),                                                                                   /* inline_ptr_bits_per_card */
                          G1RemSetArrayOfCardsEntries,                               /* max_cards_in_array */
@@ -104,6 +111,7 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint inline_ptr_bits_per_card,
                                                uint log2_card_regions_per_heap_region) :
   _inline_ptr_bits_per_card(inline_ptr_bits_per_card),
   _max_cards_in_array(max_cards_in_array),
+  _max_cards_in_small_array(small_array_size(max_cards_in_array, G1CardSetInlinePtr::max_cards_in_inline_ptr(inline_ptr_bits_per_card))),
   _num_buckets_in_howl(num_buckets_in_howl),
   _max_cards_in_card_set(max_cards_in_card_set),
   _cards_in_howl_threshold(max_cards_in_card_set * cards_in_howl_threshold_percent),
@@ -156,17 +164,19 @@ void G1CardSetConfiguration::init_card_set_alloc_options() {
   new (&_card_set_alloc_options[1]) G1CardSetAllocOptions((uint)G1CardSetArray::size_in_bytes(_max_cards_in_array), 2, 256);
   new (&_card_set_alloc_options[2]) G1CardSetAllocOptions((uint)G1CardSetBitMap::size_in_bytes(_max_cards_in_howl_bitmap), 2, 256);
   new (&_card_set_alloc_options[3]) G1CardSetAllocOptions((uint)G1CardSetHowl::size_in_bytes(_num_buckets_in_howl), 2, 256);
+  new (&_card_set_alloc_options[4]) G1CardSetAllocOptions((uint)G1CardSetArray::size_in_bytes(_max_cards_in_small_array), 2, 256);
 }
 
 void G1CardSetConfiguration::log_configuration() {
   log_debug_p(gc, remset)("Card Set container configuration: "
                           "InlinePtr #cards %u size %zu "
-                          "Array Of Cards #cards %u size %zu "
+                          "Array Of Cards #cards %u size %zu small #cards %u size %zu "
                           "Howl #buckets %u coarsen threshold %u "
                           "Howl Bitmap #cards %u size %zu coarsen threshold %u "
                           "Card regions per heap region %u cards per card region %u",
                           max_cards_in_inline_ptr(), sizeof(void*),
                           max_cards_in_array(), G1CardSetArray::size_in_bytes(max_cards_in_array()),
+                          max_cards_in_small_array(), G1CardSetArray::size_in_bytes(max_cards_in_small_array()),
                           num_buckets_in_howl(), cards_in_howl_threshold(),
                           max_cards_in_howl_bitmap(), G1CardSetBitMap::size_in_bytes(max_cards_in_howl_bitmap()), cards_in_howl_bitmap_threshold(),
                           (uint)1 << log2_card_regions_per_heap_region(),
@@ -186,7 +196,7 @@ const G1CardSetAllocOptions* G1CardSetConfiguration::mem_object_alloc_options(ui
 }
 
 const char* G1CardSetConfiguration::mem_object_type_name_str(uint index) {
-  const char* names[] = { "Node", "Array", "Bitmap", "Howl" };
+  const char* names[] = { "Node", "Array", "Bitmap", "Howl", "SmallArray" };
   return names[index];
 }
 
@@ -224,16 +234,20 @@ void G1CardSetCoarsenStats::record_coarsening(uint tag, bool collision) {
 
 void G1CardSetCoarsenStats::print_on(outputStream* out) {
   out->print_cr("Inline->AoC %zu (%zu) "
+                "SmallAoC->AoC %zu (%zu) "
                 "AoC->Howl %zu (%zu) "
                 "Howl->Full %zu (%zu) "
                 "Inline->AoC %zu (%zu) "
+                "SmallAoC->AoC %zu (%zu) "
                 "AoC->BitMap %zu (%zu) "
                 "BitMap->Full %zu (%zu) ",
                 _coarsen_from[0], _coarsen_collision[0],
+                _coarsen_from[GrowSmallArrayTag], _coarsen_collision[GrowSmallArrayTag],
                 _coarsen_from[1], _coarsen_collision[1],
                 // There is no BitMap at the first level so we can't .
                 _coarsen_from[3], _coarsen_collision[3],
                 _coarsen_from[4], _coarsen_collision[4],
+                _coarsen_from[GrowSmallArrayHowlTag], _coarsen_collision[GrowSmallArrayHowlTag],
                 _coarsen_from[5], _coarsen_collision[5],
                 _coarsen_from[6], _coarsen_collision[6]
                );
@@ -422,6 +436,13 @@ uint G1CardSet::container_type_to_mem_object_type(uintptr_t type) const {
   return (uint)type;
 }
 
+uint G1CardSet::array_mem_object_type(uint num_cards) const {
+  assert(num_cards == _config->max_cards_in_array() ||
+         num_cards == _config->max_cards_in_small_array(), "unexpected array size %u", num_cards);
+  return num_cards < _config->max_cards_in_array() ? G1CardSetConfiguration::small_array_mem_object_type()
+                                                   : container_type_to_mem_object_type(ContainerArrayOfCards);
+}
+
 uint8_t* G1CardSet::allocate_mem_object(uintptr_t type) {
   return _mm->allocate(container_type_to_mem_object_type(type));
 }
@@ -438,7 +459,12 @@ void G1CardSet::free_mem_object(ContainerPtr container) {
          type == G1CardSet::ContainerHowl, "should not free card set type %zu", type);
   assert(static_cast<G1CardSetContainer*>(value)->refcount() == 1, "must be");
 
-  _mm->free(container_type_to_mem_object_type(type), value);
+  if (type == G1CardSet::ContainerArrayOfCards) {
+    uint num_cards = (uint)static_cast<G1CardSetArray*>(value)->max_entries();
+    _mm->free(array_mem_object_type(num_cards), value);
+  } else {
+    _mm->free(container_type_to_mem_object_type(type), value);
+  }
 }
 
 G1CardSet::ContainerPtr G1CardSet::acquire_container(ContainerPtr volatile* container_addr) {
@@ -545,7 +571,7 @@ G1AddCardResult G1CardSet::add_to_howl(ContainerPtr parent_container,
     }
     // Card set container has overflown. Coarsen or retry.
     bool coarsened = coarsen_container(bucket_entry, container, card_in_region, true /* within_howl */);
-    _coarsen_stats.record_coarsening(container_type(container) + G1CardSetCoarsenStats::CoarsenHowlOffset, !coarsened);
+    _coarsen_stats.record_coarsening(coarsen_stats_tag(container, true /* within_howl */), !coarsened);
     if (coarsened) {
       // We successful coarsened this card set container (and in the process added the card).
       add_result = Added;
@@ -596,6 +622,20 @@ G1CardSet::ContainerPtr G1CardSet::create_coarsened_array_of_cards(uint card_in_
   return new_container;
 }
 
+G1CardSet::ContainerPtr G1CardSet::create_array_of_cards(uint card_in_region, uint num_cards) {
+  uint8_t* data = _mm->allocate(array_mem_object_type(num_cards));
+  new (data) G1CardSetArray(card_in_region, num_cards);
+  return make_container_ptr(data, ContainerArrayOfCards);
+}
+
+uint G1CardSet::coarsen_stats_tag(ContainerPtr container, bool within_howl) const {
+  if (container_type(container) == ContainerArrayOfCards &&
+      container_ptr<G1CardSetArray>(container)->max_entries() < _config->max_cards_in_array()) {
+    return within_howl ? G1CardSetCoarsenStats::GrowSmallArrayHowlTag : G1CardSetCoarsenStats::GrowSmallArrayTag;
+  }
+  return (uint)container_type(container) + (within_howl ? G1CardSetCoarsenStats::CoarsenHowlOffset : 0);
+}
+
 bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
                                   ContainerPtr cur_container,
                                   uint card_in_region,
@@ -604,7 +644,12 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
 
   switch (container_type(cur_container)) {
     case ContainerArrayOfCards: {
-      new_container = create_coarsened_array_of_cards(card_in_region, within_howl);
+      if (container_ptr<G1CardSetArray>(cur_container)->max_entries() < _config->max_cards_in_array()) {
+        // A small array first grows to a full sized one.
+        new_container = create_array_of_cards(card_in_region, _config->max_cards_in_array());
+      } else {
+        new_container = create_coarsened_array_of_cards(card_in_region, within_howl);
+      }
       break;
     }
     case ContainerBitMap: {
@@ -612,10 +657,7 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
       break;
     }
     case ContainerInlinePtr: {
-      uint const size = _config->max_cards_in_array();
-      uint8_t* data = allocate_mem_object(ContainerArrayOfCards);
-      new (data) G1CardSetArray(card_in_region, size);
-      new_container = make_container_ptr(data, ContainerArrayOfCards);
+      new_container = create_array_of_cards(card_in_region, _config->max_cards_in_small_array());
       break;
     }
     case ContainerHowl: {
@@ -792,7 +834,7 @@ G1AddCardResult G1CardSet::add_card(uint card_region, uint card_in_region, bool
     }
     // Card set has overflown. Coarsen or retry.
     bool coarsened = coarsen_container(&table_entry->_container, container, card_in_region);
-    _coarsen_stats.record_coarsening(container_type(container), !coarsened);
+    _coarsen_stats.record_coarsening(coarsen_stats_tag(container, false /* within_howl */), !coarsened);
     if (coarsened) {
       // We successful coarsened this card set container (and in the process added the card).
       add_result = Added;
@@ -819,6 +861,85 @@ G1AddCardResult G1CardSet::add_card(uint card_region, uint card_in_region, bool
   return add_result;
 }
 
+size_t G1CardSet::add_cards(const uintptr_t* cards, size_t num_cards) {
+  const uint MaxCardsPerRun = 64;
+  uint cards_in_region[MaxCardsPerRun];
+  uint num_cards_in_region = 0;
+  uint cur_region = 0;
+  size_t num_added = 0;
+
+  for (size_t i = 0; i < num_cards; i++) {
+    uint card_region;
+    uint card_in_region;
+    split_card(cards[i], card_region, card_in_region);
+
+    if (num_cards_in_region > 0 &&
+        (card_region != cur_region || num_cards_in_region == MaxCardsPerRun)) {
+      num_added += add_cards(cur_region, cards_in_region, num_cards_in_region);
+      num_cards_in_region = 0;
+    }
+    cur_region = card_region;
+    cards_in_region[num_cards_in_region++] = card_in_region;
+  }
+  if (num_cards_in_region > 0) {
+    num_added += add_cards(cur_region, cards_in_region, num_cards_in_region);
+  }
+  return num_added;
+}
+
+uint G1CardSet::add_cards(uint card_region, const uint* cards_in_region, uint num_cards) {
+  bool should_grow_table = false;
+  G1CardSetHashTableValue* table_entry = get_or_add_container(card_region, &should_grow_table);
+
+  uint num_added = 0;
+  // Number of cards added that are not yet reflected in the occupancy counters.
+  uint num_pending = 0;
+
+  ContainerPtr container = acquire_container(&table_entry->_container);
+  uint i = 0;
+  while (i < num_cards && container != FullCardSet) {
+    uint card_in_region = cards_in_region[i];
+    G1AddCardResult add_result = add_to_container(&table_entry->_container, container, card_region, card_in_region);
+
+    if (add_result != Overflow) {
+      num_pending += (add_result == Added) ? 1 : 0;
+      i++;
+      continue;
+    }
+    // Card set has overflown. Coarsen or retry.
+    bool coarsened = coarsen_container(&table_entry->_container, container, card_in_region);
+    _coarsen_stats.record_coarsening(coarsen_stats_tag(container, false /* within_howl */), !coarsened);
+    if (coarsened) {
+      // We successful coarsened this card set container (and in the process added the card).
+      // Transferring the cards relies on the occupancy of the table entry to be
+      // up to date, so account for the cards added so far first.
+      num_pending++;
+      i++;
+      Atomic::add(&table_entry->_num_occupied, num_pending, memory_order_relaxed);
+      Atomic::add(&_num_occupied, (size_t)num_pending, memory_order_relaxed);
+      num_added += num_pending;
+      num_pending = 0;
+      transfer_cards(table_entry, container, card_region);
+    }
+    // Continue, or retry if somebody else beat us to coarsening, with the new container.
+    release_and_maybe_free_container(container);
+    container = acquire_container(&table_entry->_container);
+  }
+
+  if (num_pending > 0) {
+    Atomic::add(&table_entry->_num_occupied, num_pending, memory_order_relaxed);
+    Atomic::add(&_num_occupied, (size_t)num_pending, memory_order_relaxed);
+    num_added += num_pending;
+  }
+  if (should_grow_table) {
+    _table->grow();
+  }
+
+  release_and_maybe_free_container(container);
+
+  return num_added;
+}
+
 bool G1CardSet::contains_card(uint card_region, uint card_in_region) {
   assert(card_in_region < _config->max_cards_in_region(),
          "Card %u is beyond max %u", card_in_region, _config->max_cards_in_region());
@@ -1026,6 +1147,10 @@ size_t G1CardSet::unused_mem_size() const {
   return _mm->unused_mem_size();
 }
 
+size_t G1CardSet::small_array_saved_mem_size() const {
+  return _mm->small_array_saved_mem_size();
+}
+
 size_t G1CardSet::static_mem_size() {
   return sizeof(FullCardSet) + sizeof(_coarsen_stats);
 }
@@ -49,6 +49,7 @@ class G1CardSetConfiguration {
   uint _inline_ptr_bits_per_card;
 
   uint _max_cards_in_array;
+  uint _max_cards_in_small_array;
   uint _num_buckets_in_howl;
   uint _max_cards_in_card_set;
   uint _cards_in_howl_threshold;
@@ -95,6 +96,11 @@ class G1CardSetConfiguration {
   // Maximum number of cards in "Array of Cards" set; 0 to disable.
   // Always coarsen to next level if full, so no specific threshold.
   uint max_cards_in_array() const { return _max_cards_in_array; }
+  // Number of cards in the "Array of Cards" set created when coarsening an
+  // inline pointer. Most card regions never fill a full sized array, so
+  // small arrays are only grown to full size when they overflow. Equal to
+  // max_cards_in_array() if small arrays are disabled.
+  uint max_cards_in_small_array() const { return _max_cards_in_small_array; }
 
   // Bitmap within Howl card set container configuration
   uint max_cards_in_howl_bitmap() const { return _max_cards_in_howl_bitmap; }
@@ -131,8 +137,11 @@ class G1CardSetConfiguration {
 
   // Memory object types configuration
   // Number of distinctly sized memory objects on the card set heap.
-  // Currently contains CHT-Nodes, ArrayOfCards, BitMaps, Howl
-  static constexpr uint num_mem_object_types() { return 4; }
+  // Currently contains CHT-Nodes, ArrayOfCards, BitMaps, Howl, small ArrayOfCards
+  static constexpr uint num_mem_object_types() { return 5; }
+  // The memory object type of small arrays of cards. The other types correspond
+  // to the container type they hold.
+  static constexpr uint small_array_mem_object_type() { return 4; }
   // Returns the memory allocation options for the memory objects on the card set heap.
   const G1CardSetAllocOptions* mem_object_alloc_options(uint idx);
 
@@ -146,11 +155,16 @@ class G1CardSetCoarsenStats {
 public:
   // Number of entries in the statistics tables: since we index with the source
   // container of the coarsening, this is the total number of combinations of
-  // card set containers - 1.
-  static constexpr size_t NumCoarsenCategories = 7;
+  // card set containers - 1, plus the growth of small arrays of cards at both
+  // levels.
+  static constexpr size_t NumCoarsenCategories = 9;
   // Coarsening statistics for the possible ContainerPtr in the Howl card set
   // start from this offset.
   static constexpr size_t CoarsenHowlOffset = 4;
+  // Growing a small array of cards into a full sized one is not a coarsening,
+  // and is recorded separately (see G1CardSetConfiguration::max_cards_in_small_array()).
+  static constexpr size_t GrowSmallArrayTag = 7;
+  static constexpr size_t GrowSmallArrayHowlTag = 8;
 
 private:
   // Indices are "from" indices.
@@ -293,6 +307,9 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
                          uint card_in_region, bool within_howl = false);
 
   ContainerPtr create_coarsened_array_of_cards(uint card_in_region, bool within_howl);
+  ContainerPtr create_array_of_cards(uint card_in_region, uint num_cards);
+  // Returns the coarsening statistics category for an overflow of the given container.
+  uint coarsen_stats_tag(ContainerPtr container, bool within_howl) const;
 
   // Transfer entries from source_card_set to a recently installed coarser storage type
   // We only need to transfer anything finer than ContainerBitMap. "Full" contains
@@ -320,12 +337,16 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   void iterate_cards_during_transfer(ContainerPtr const container, CardVisitor& vl);
 
   uint container_type_to_mem_object_type(uintptr_t type) const;
+  uint array_mem_object_type(uint num_cards) const;
   uint8_t* allocate_mem_object(uintptr_t type);
   void free_mem_object(ContainerPtr container);
 
   void split_card(uintptr_t card, uint& card_region, uint& card_within_region) const;
 
   G1AddCardResult add_card(uint card_region, uint card_in_region, bool increment_total = true);
+  // Adds the given cards, all within card_region, to this set. Returns the
+  // number of cards added.
+  uint add_cards(uint card_region, const uint* cards_in_region, uint num_cards);
 
   bool contains_card(uint card_region, uint card_in_region);
 
@@ -350,6 +371,13 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // If incremental_count is true and the card has been added, updates the total count.
   G1AddCardResult add_card(uintptr_t card);
 
+  // Adds the given cards to this set. Cards within the same region must be
+  // adjacent, e.g. by sorting them. Compared to adding cards one by one, every
+  // run of cards within the same region looks up and reference counts the
+  // container only once, and updates the occupancy counters only once.
+  // Returns the number of cards added.
+  size_t add_cards(const uintptr_t* cards, size_t num_cards);
+
   bool contains_card(uintptr_t card);
 
   void print_info(outputStream* st, uintptr_t card);
@@ -372,6 +400,8 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // Returns size of the actual remembered set containers in bytes.
   size_t mem_size() const;
   size_t unused_mem_size() const;
+  // Returns the memory saved by using small instead of full sized arrays of cards.
+  size_t small_array_saved_mem_size() const;
   // Returns the size of static data in bytes.
   static size_t static_mem_size();
 
@@ -195,6 +195,7 @@ class G1CardSetArray : public G1CardSetContainer {
   void iterate(CardVisitor& found);
 
   size_t num_entries() const { return _num_entries & EntryMask; }
+  size_t max_entries() const { return _size; }
 
   static size_t header_size_in_bytes();
 
@@ -66,6 +66,10 @@ size_t G1CardSetAllocator::unused_mem_size() const {
   return num_unused_slots * _arena.slot_size();
 }
 
+uint G1CardSetAllocator::num_used_slots() const {
+  return _arena.num_allocated_slots() - (uint)_free_slots_list.free_count();
+}
+
 uint G1CardSetAllocator::num_segments() const {
   return _arena.num_segments();
 }
@@ -123,6 +127,14 @@ size_t G1CardSetMemoryManager::unused_mem_size() const {
   return result;
 }
 
+size_t G1CardSetMemoryManager::small_array_saved_mem_size() const {
+  uint const array_type = G1CardSet::ContainerArrayOfCards;
+  uint const small_array_type = G1CardSetConfiguration::small_array_mem_object_type();
+  size_t const saved_per_array = _config->mem_object_alloc_options(array_type)->slot_size() -
+                                 _config->mem_object_alloc_options(small_array_type)->slot_size();
+  return _allocators[small_array_type].num_used_slots() * saved_per_array;
+}
+
 G1MonotonicArenaMemoryStats G1CardSetMemoryManager::memory_stats() const {
   G1MonotonicArenaMemoryStats result;
   for (uint i = 0; i < num_mem_object_types(); i++) {
@@ -86,6 +86,9 @@ class G1CardSetAllocator {
 
   size_t unused_mem_size() const;
 
+  // Number of slots currently handed out.
+  uint num_used_slots() const;
+
   uint num_segments() const;
 };
 
@@ -115,6 +118,8 @@ class G1CardSetMemoryManager : public CHeapObj<mtGCCardSet> {
 
   size_t mem_size() const;
   size_t unused_mem_size() const;
+  // Memory saved by the small arrays of cards in use compared to full sized ones.
+  size_t small_array_saved_mem_size() const;
 
   G1MonotonicArenaMemoryStats memory_stats() const;
 };
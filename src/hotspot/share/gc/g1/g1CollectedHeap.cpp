@@ -51,6 +51,7 @@
 #include "gc/g1/g1HeapTransition.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1InitLogger.hpp"
+#include "gc/g1/g1KlassSurvivalTable.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/g1/g1MonotonicArenaFreeMemoryTask.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
@@ -1246,6 +1247,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _gc_tracer_stw(new G1NewTracer()),
   _policy(new G1Policy(_gc_timer_stw)),
   _heap_sizing_policy(nullptr),
+  _klass_survival_table(nullptr),
   _collection_set(this, _policy),
   _rem_set(nullptr),
   _card_set_config(),
@@ -1268,6 +1270,10 @@ G1CollectedHeap::G1CollectedHeap() :
 
   _heap_sizing_policy = G1HeapSizingPolicy::create(this, _policy->analytics());
 
+  if (G1EarlyPromotion) {
+    _klass_survival_table = new G1KlassSurvivalTable();
+  }
+
   _humongous_object_threshold_in_words = humongous_threshold_for(HeapRegion::GrainWords);
 
   // Override the default _filler_array_max_size so that no humongous filler
@@ -2180,12 +2186,21 @@ bool G1CollectedHeap::is_obj_dead_cond(const oop obj,
   return false; // keep some compilers happy
 }
 
+// Instead of blocking garbage collections with the GCLocker, G1 pins the region
+// containing the object. Regions with pinned objects are not evacuated: young
+// regions fail evacuation in place, and old regions are not selected into the
+// collection set.
 void G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
-  GCLocker::lock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_gc_active(), "must not pin objects during a GC");
+  assert(obj->is_typeArray(), "must be typeArray");
+  heap_region_containing(obj)->increment_pinned_object_count();
 }
 
 void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
-  GCLocker::unlock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_gc_active(), "must not unpin objects during a GC");
+  heap_region_containing(obj)->decrement_pinned_object_count();
 }
 
 void G1CollectedHeap::print_heap_regions() const {
@@ -2231,7 +2246,8 @@ void G1CollectedHeap::print_regions_on(outputStream* st) const {
                "HS=humongous(starts), HC=humongous(continues), "
                "CS=collection set, F=free, "
                "TAMS=top-at-mark-start, "
-               "PB=parsable bottom");
+               "PB=parsable bottom, "
+               "P=pinned object count");
   PrintRegionClosure blk(st);
   heap_region_iterate(&blk);
 }
@@ -2593,6 +2609,11 @@ void G1CollectedHeap::complete_cleaning(bool class_unloading_occurred) {
   uint num_workers = workers()->active_workers();
   G1ParallelCleaningTask unlink_task(num_workers, class_unloading_occurred);
   workers()->run_task(&unlink_task);
+
+  if (class_unloading_occurred && _klass_survival_table != nullptr) {
+    // Entries may refer to unloaded classes.
+    _klass_survival_table->clear();
+  }
 }
 
 bool G1STWSubjectToDiscoveryClosure::do_object_b(oop obj) {
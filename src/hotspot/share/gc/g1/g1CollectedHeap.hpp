@@ -75,6 +75,7 @@ class G1ConcurrentRefine;
 class G1GCCounters;
 class G1GCPhaseTimes;
 class G1HeapSizingPolicy;
+class G1KlassSurvivalTable;
 class G1NewTracer;
 class G1RemSet;
 class G1ServiceTask;
@@ -383,6 +384,8 @@ class G1CollectedHeap : public CollectedHeap {
   // The current policy object for the collector.
   G1Policy* _policy;
   G1HeapSizingPolicy* _heap_sizing_policy;
+  // Survival samples for G1EarlyPromotion, null if disabled.
+  G1KlassSurvivalTable* _klass_survival_table;
 
   G1CollectionSet _collection_set;
 
@@ -906,6 +909,8 @@ class G1CollectedHeap : public CollectedHeap {
 
   // The current policy object for the collector.
   G1Policy* policy() const { return _policy; }
+  G1HeapSizingPolicy* heap_sizing_policy() const { return _heap_sizing_policy; }
+  G1KlassSurvivalTable* klass_survival_table() const { return _klass_survival_table; }
   // The remembered set.
   G1RemSet* rem_set() const { return _rem_set; }
 
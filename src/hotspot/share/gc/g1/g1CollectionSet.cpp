@@ -324,13 +324,15 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
     candidates()->verify();
 
     G1CollectionCandidateRegionList initial_old_regions;
+    G1CollectionCandidateRegionList pinned_marking_regions;
     assert(_optional_old_regions.length() == 0, "must be");
 
     if (collector_state()->in_mixed_phase()) {
       time_remaining_ms = _policy->select_candidates_from_marking(&candidates()->marking_regions(),
                                                                   time_remaining_ms,
                                                                   &initial_old_regions,
-                                                                  &_optional_old_regions);
+                                                                  &_optional_old_regions,
+                                                                  &pinned_marking_regions);
     } else {
       log_debug(gc, ergo, cset)("Do not add marking candidates to collection set due to pause type.");
     }
@@ -344,6 +346,9 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
     move_candidates_to_collection_set(&initial_old_regions);
     // Only prepare selected optional regions for now.
     prepare_optional_regions(&_optional_old_regions);
+    // Marking candidates that can not be evacuated because of pinned objects are
+    // retained, so that they do not prolong the mixed phase.
+    move_pinned_marking_to_retained(&pinned_marking_regions);
 
     candidates()->verify();
   } else {
@@ -366,6 +371,19 @@ void G1CollectionSet::move_candidates_to_collection_set(G1CollectionCandidateReg
   candidates()->remove(regions);
 }
 
+void G1CollectionSet::move_pinned_marking_to_retained(G1CollectionCandidateRegionList* regions) {
+  if (regions->length() == 0) {
+    return;
+  }
+  candidates()->remove(regions);
+
+  for (HeapRegion* r : *regions) {
+    assert(r->has_pinned_objects(), "must be pinned");
+    candidates()->add_retained_region_unsorted(r);
+  }
+  candidates()->sort_by_efficiency();
+}
+
 void G1CollectionSet::prepare_optional_regions(G1CollectionCandidateRegionList* regions){
   uint cur_index = 0;
   for (HeapRegion* r : *regions) {
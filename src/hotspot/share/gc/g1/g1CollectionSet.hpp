@@ -174,6 +174,8 @@ class G1CollectionSet {
   void add_old_region(HeapRegion* hr);
 
   void move_candidates_to_collection_set(G1CollectionCandidateRegionList* regions);
+  // Moves the given marking candidates with pinned objects to the retained regions.
+  void move_pinned_marking_to_retained(G1CollectionCandidateRegionList* regions);
   // Prepares old regions in the given set for optional collection later. Does not
   // add the region to collection set yet.
   void prepare_optional_regions(G1CollectionCandidateRegionList* regions);
@@ -31,6 +31,7 @@
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1FreeIdSet.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
+#include "gc/g1/g1RefinementBatch.inline.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/g1ThreadLocalData.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -346,6 +347,7 @@ class G1RefineBufferedCards : public StackObj {
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
   G1RemSet* const _g1rs;
+  G1RefinementBatch _batch;
 
   static inline ptrdiff_t compare_cards(const CardTable::CardValue* p1,
                                         const CardTable::CardValue* p2) {
@@ -408,8 +410,11 @@ class G1RefineBufferedCards : public StackObj {
         result = false;
         break;
       }
-      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+      _g1rs->refine_card_concurrently(_node_buffer[i], &_batch);
     }
+    // Add the remembered set entries of the refined cards before a
+    // safepoint may start.
+    _batch.flush();
     _node->set_index(i);
     _stats->inc_refined_cards(i - start_index);
     return result;
@@ -430,7 +435,8 @@ class G1RefineBufferedCards : public StackObj {
     _node_buffer_capacity(node->capacity()),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1rs(G1CollectedHeap::heap()->rem_set()),
+    _batch(G1CollectedHeap::heap(), worker_id) {}
 
   bool refine() {
     size_t first_clean_index = clean_cards();
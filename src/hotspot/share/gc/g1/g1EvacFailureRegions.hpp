@@ -43,6 +43,8 @@ class G1EvacFailureRegions {
   uint* _evac_failure_regions;
   // Number of regions evacuation failed in the current collection.
   volatile uint _evac_failure_regions_cur_length;
+  // Number of regions that failed evacuation because they contain pinned objects.
+  volatile uint _num_regions_pinned;
 
 public:
   G1EvacFailureRegions();
@@ -74,10 +76,21 @@ class G1EvacFailureRegions {
     return num_regions_failed_evacuation() > 0;
   }
 
+  // Whether evacuation failed in some region because of an allocation failure,
+  // as opposed to only because regions contained pinned objects.
+  bool has_regions_alloc_failed() const {
+    return num_regions_failed_evacuation() > Atomic::load(&_num_regions_pinned);
+  }
+
+  bool has_regions_evac_pinned() const {
+    return Atomic::load(&_num_regions_pinned) > 0;
+  }
+
   // Record that the garbage collection encountered an evacuation failure in the
   // given region. Returns whether this has been the first occurrence of an evacuation
-  // failure in that region.
-  inline bool record(uint region_idx);
+  // failure in that region. Since objects in regions with pinned objects are never
+  // copied, all evacuation failures in such a region have cause_pinned set.
+  inline bool record(uint region_idx, bool cause_pinned);
 };
 
 #endif //SHARE_GC_G1_G1EVACFAILUREREGIONS_HPP
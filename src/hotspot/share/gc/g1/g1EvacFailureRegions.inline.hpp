@@ -29,12 +29,15 @@
 #include "gc/g1/g1EvacFailureRegions.hpp"
 #include "runtime/atomic.hpp"
 
-bool G1EvacFailureRegions::record(uint region_idx) {
+bool G1EvacFailureRegions::record(uint region_idx, bool cause_pinned) {
   bool success = _regions_failed_evacuation.par_set_bit(region_idx,
                                                         memory_order_relaxed);
   if (success) {
     size_t offset = Atomic::fetch_then_add(&_evac_failure_regions_cur_length, 1u);
     _evac_failure_regions[offset] = region_idx;
+    if (cause_pinned) {
+      Atomic::inc(&_num_regions_pinned);
+    }
 
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     HeapRegion* hr = g1h->region_at(region_idx);
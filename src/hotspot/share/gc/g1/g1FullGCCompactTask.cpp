@@ -32,8 +32,40 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/ticks.hpp"
 
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+    G1FullGCTask("G1 Compact Task", collector),
+    _collector(collector),
+    _claimer(collector->workers()),
+    _g1h(G1CollectedHeap::heap()),
+    _num_queues(collector->workers()),
+    _queue_claims(NEW_C_HEAP_ARRAY(uint, _num_queues, mtGC)),
+    _queue_position(NEW_C_HEAP_ARRAY(uint, _g1h->max_reserved_regions(), mtGC)),
+    _first_destination_position(NEW_C_HEAP_ARRAY(uint, _g1h->max_reserved_regions(), mtGC)),
+    _compacted(NEW_C_HEAP_ARRAY(bool, _g1h->max_reserved_regions(), mtGC)) {
+  // Only entries for regions in the compaction queues are ever accessed.
+  for (uint queue = 0; queue < _num_queues; queue++) {
+    _queue_claims[queue] = 0;
+    GrowableArray<HeapRegion*>* regions = collector->compaction_point(queue)->regions();
+    for (int pos = 0; pos < regions->length(); pos++) {
+      uint region_idx = regions->at(pos)->hrm_index();
+      _queue_position[region_idx] = (uint)pos;
+      _first_destination_position[region_idx] = NoPosition;
+      _compacted[region_idx] = false;
+    }
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  FREE_C_HEAP_ARRAY(uint, _queue_claims);
+  FREE_C_HEAP_ARRAY(uint, _queue_position);
+  FREE_C_HEAP_ARRAY(uint, _first_destination_position);
+  FREE_C_HEAP_ARRAY(bool, _compacted);
+}
+
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
   assert(_bitmap->is_marked(obj), "Should only compact marked objects");
   _bitmap->clear(obj);
@@ -84,14 +116,113 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   hr->reset_compacted_after_full_gc(_collector->compaction_top(hr));
 }
 
+void G1FullGCCompactTask::compute_first_destination_positions(uint queue) {
+  // Must be done by the owner of the queue before any of its regions are
+  // compacted, as compaction overwrites the objects examined here.
+  G1CMBitMap* bitmap = collector()->mark_bitmap();
+  GrowableArray<HeapRegion*>* regions = collector()->compaction_point(queue)->regions();
+  for (int i = 0; i < regions->length(); i++) {
+    HeapRegion* hr = regions->at(i);
+    uint pos = (uint)i;
+    // Objects are moved to increasing addresses in queue order, so the
+    // destination of the first live object is the lowest one of the region.
+    // Objects that are not forwarded stay in place.
+    uint first_pos = pos;
+    if (!collector()->is_free(hr->hrm_index())) {
+      HeapWord* first = bitmap->get_next_marked_addr(hr->bottom(), hr->top());
+      if (first < hr->top() && cast_to_oop(first)->is_forwarded()) {
+        uint dest_idx = _g1h->addr_to_region(cast_from_oop<HeapWord*>(cast_to_oop(first)->forwardee()));
+        first_pos = _queue_position[dest_idx];
+        assert(first_pos <= pos, "Objects must not move to later regions in the queue");
+      }
+    }
+    Atomic::release_store(&_first_destination_position[hr->hrm_index()], first_pos);
+  }
+}
+
+bool G1FullGCCompactTask::destinations_compacted(uint queue, uint first_pos, uint pos) const {
+  GrowableArray<HeapRegion*>* regions = _collector->compaction_point(queue)->regions();
+  // Check backwards; the most recently claimed regions are the most likely
+  // to still be in progress.
+  for (uint i = pos; i > first_pos; i--) {
+    if (!Atomic::load_acquire(&_compacted[regions->at(i - 1)->hrm_index()])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void G1FullGCCompactTask::wait_for_destinations(uint queue, uint pos) const {
+  GrowableArray<HeapRegion*>* regions = _collector->compaction_point(queue)->regions();
+  uint first_pos = Atomic::load_acquire(&_first_destination_position[regions->at(pos)->hrm_index()]);
+  assert(first_pos != NoPosition, "Owner must have computed destinations");
+  for (uint i = first_pos; i < pos; i++) {
+    // These regions have already been claimed by workers currently
+    // compacting them, so the wait is short.
+    while (!Atomic::load_acquire(&_compacted[regions->at(i)->hrm_index()])) {
+      SpinPause();
+    }
+  }
+}
+
+uint G1FullGCCompactTask::claim_next(uint queue) {
+  uint length = (uint)collector()->compaction_point(queue)->regions()->length();
+  uint pos = Atomic::fetch_then_add(&_queue_claims[queue], 1u);
+  return pos < length ? pos : NoPosition;
+}
+
+uint G1FullGCCompactTask::try_steal(uint queue) {
+  GrowableArray<HeapRegion*>* regions = collector()->compaction_point(queue)->regions();
+  uint length = (uint)regions->length();
+  uint pos = Atomic::load(&_queue_claims[queue]);
+  while (pos < length) {
+    uint first_pos = Atomic::load_acquire(&_first_destination_position[regions->at(pos)->hrm_index()]);
+    if (first_pos == NoPosition || !destinations_compacted(queue, first_pos, pos)) {
+      // Leave the region to the owner of the queue.
+      return NoPosition;
+    }
+    uint cur = Atomic::cmpxchg(&_queue_claims[queue], pos, pos + 1);
+    if (cur == pos) {
+      return pos;
+    }
+    pos = cur;
+  }
+  return NoPosition;
+}
+
+void G1FullGCCompactTask::compact_queue_region(uint queue, uint pos) {
+  HeapRegion* hr = collector()->compaction_point(queue)->regions()->at(pos);
+  compact_region(hr);
+  Atomic::release_store(&_compacted[hr->hrm_index()], true);
+}
+
+void G1FullGCCompactTask::steal_work(uint worker_id) {
+  bool found;
+  do {
+    found = false;
+    for (uint i = 1; i < _num_queues; i++) {
+      uint queue = (worker_id + i) % _num_queues;
+      uint pos;
+      while ((pos = try_steal(queue)) != NoPosition) {
+        compact_queue_region(queue, pos);
+        found = true;
+      }
+    }
+  } while (found);
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+  compute_first_destination_positions(worker_id);
+
+  uint pos;
+  while ((pos = claim_next(worker_id)) != NoPosition) {
+    wait_for_destinations(worker_id, pos);
+    compact_queue_region(worker_id, pos);
   }
+
+  // Help workers with longer queues.
+  steal_work(worker_id);
 }
 
 void G1FullGCCompactTask::serial_compaction() {
@@ -40,6 +40,29 @@ class G1FullGCCompactTask : public G1FullGCTask {
   HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
 
+  // Work stealing support for the parallel compaction. Every worker's queue
+  // is claimed in order through _queue_claims. A region may only be compacted
+  // after all regions in the same queue that its objects move into have been
+  // compacted themselves. The owner of a queue waits for those regions,
+  // other workers only steal regions that can be compacted right away.
+  // The remaining arrays are indexed by region index.
+  uint _num_queues;
+  uint volatile* _queue_claims;
+  uint* _queue_position;
+  uint volatile* _first_destination_position;
+  bool volatile* _compacted;
+
+  static const uint NoPosition = UINT_MAX;
+
+  void compute_first_destination_positions(uint queue);
+  bool destinations_compacted(uint queue, uint first_pos, uint pos) const;
+  void wait_for_destinations(uint queue, uint pos) const;
+
+  uint claim_next(uint queue);
+  uint try_steal(uint queue);
+  void steal_work(uint worker_id);
+  void compact_queue_region(uint queue, uint pos);
+
   void compact_region(HeapRegion* hr);
   void compact_humongous_obj(HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
@@ -47,11 +70,8 @@ class G1FullGCCompactTask : public G1FullGCTask {
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
   void serial_compaction();
@@ -42,7 +42,7 @@ void G1DetermineCompactionQueueClosure::free_empty_humongous_region(HeapRegion*
 inline bool G1DetermineCompactionQueueClosure::should_compact(HeapRegion* hr) const {
   // There is no need to iterate and forward objects in non-movable regions ie.
   // prepare them for compaction.
-  if (hr->is_humongous()) {
+  if (hr->is_humongous() || hr->has_pinned_objects()) {
     return false;
   }
   size_t live_words = _collector->live_words(hr->hrm_index());
@@ -87,6 +87,11 @@ inline bool G1DetermineCompactionQueueClosure::do_heap_region(HeapRegion* hr) {
       } else {
         _collector->set_has_humongous();
       }
+    } else if (hr->has_pinned_objects()) {
+      // Objects in the region must not move; skip compacting it.
+      _collector->update_from_compacting_to_skip_compacting(hr->hrm_index());
+      log_trace(gc, phases)("Phase 2: skip compaction region index: %u, pinned objects: " SIZE_FORMAT,
+                            hr->hrm_index(), hr->pinned_count());
     } else {
       assert(MarkSweepDeadRatio > 0,
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
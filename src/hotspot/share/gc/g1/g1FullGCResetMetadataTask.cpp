@@ -91,8 +91,9 @@ void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_skip_compacting(He
     oop obj = cast_to_oop(hr->humongous_start_region()->bottom());
     assert(_collector->mark_bitmap()->is_marked(obj), "must be live");
   } else {
-    assert(_collector->live_words(region_index) > _collector->scope()->region_compaction_threshold(),
-           "should be quite full");
+    assert(hr->has_pinned_objects() ||
+           _collector->live_words(region_index) > _collector->scope()->region_compaction_threshold(),
+           "should be quite full or pinned");
   }
 
   assert(_collector->compaction_top(hr) == nullptr,
@@ -28,6 +28,7 @@
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -39,7 +40,8 @@ G1HeapSizingPolicy* G1HeapSizingPolicy::create(const G1CollectedHeap* g1h, const
 G1HeapSizingPolicy::G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics) :
   _g1h(g1h),
   _analytics(analytics),
-  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()) {
+  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()),
+  _under_memory_pressure(false) {
 
   assert(MinOverThresholdForGrowth < _num_prev_pauses_for_heuristics, "Threshold must be less than %u", _num_prev_pauses_for_heuristics);
   clear_ratio_check_data();
@@ -51,6 +53,14 @@ void G1HeapSizingPolicy::clear_ratio_check_data() {
   _pauses_since_start = 0;
 }
 
+bool G1HeapSizingPolicy::is_under_memory_pressure() const {
+  return Atomic::load(&_under_memory_pressure);
+}
+
+void G1HeapSizingPolicy::set_under_memory_pressure(bool value) {
+  Atomic::store(&_under_memory_pressure, value);
+}
+
 double G1HeapSizingPolicy::scale_with_heap(double pause_time_threshold) {
   double threshold = pause_time_threshold;
   // If the heap is at less than half its maximum size, scale the threshold down,
@@ -86,6 +96,12 @@ static void log_expansion(double short_term_pause_time_ratio,
 size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   assert(GCTimeRatio > 0, "must be");
 
+  if (is_under_memory_pressure()) {
+    log_debug(gc, ergo, heap)("Heap expansion: container under memory pressure, do not expand");
+    clear_ratio_check_data();
+    return 0;
+  }
+
   double long_term_pause_time_ratio = _analytics->long_term_pause_time_ratio();
   double short_term_pause_time_ratio = _analytics->short_term_pause_time_ratio();
   const double pause_time_threshold = 1.0 / (1.0 + GCTimeRatio);
@@ -226,8 +242,12 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
                                // results.
                                _g1h->eden_regions_count() * HeapRegion::GrainBytes;
 
+  // Give back as much memory as MinHeapFreeRatio allows while the container
+  // is under memory pressure.
+  const uintx max_heap_free_ratio = is_under_memory_pressure() ? MinHeapFreeRatio : MaxHeapFreeRatio;
+
   size_t minimum_desired_capacity = target_heap_capacity(used_after_gc, MinHeapFreeRatio);
-  size_t maximum_desired_capacity = target_heap_capacity(used_after_gc, MaxHeapFreeRatio);
+  size_t maximum_desired_capacity = target_heap_capacity(used_after_gc, max_heap_free_ratio);
 
   // This assert only makes sense here, before we adjust them
   // with respect to the min and max heap size.
@@ -264,7 +284,7 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
     log_debug(gc, ergo, heap)("Attempt heap shrinking (capacity higher than max desired capacity). "
                               "Capacity: " SIZE_FORMAT "B occupancy: " SIZE_FORMAT "B live: " SIZE_FORMAT "B "
                               "maximum_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%)",
-                              capacity_after_gc, used_after_gc, _g1h->used(), maximum_desired_capacity, MaxHeapFreeRatio);
+                              capacity_after_gc, used_after_gc, _g1h->used(), maximum_desired_capacity, max_heap_free_ratio);
 
     expand = false;
     return shrink_bytes;
@@ -45,6 +45,9 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   double _ratio_over_threshold_sum;
   uint _pauses_since_start;
 
+  // Set by the periodic GC task while the container is under memory pressure.
+  volatile bool _under_memory_pressure;
+
   // Scale "full" gc pause time threshold with heap size as we want to resize more
   // eagerly at small heap sizes.
   double scale_with_heap(double pause_time_threshold);
@@ -62,6 +65,12 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // Clear ratio tracking data used by expansion_amount().
   void clear_ratio_check_data();
 
+  // While under memory pressure the heap is not expanded after young
+  // collections and is shrunk down to MinHeapFreeRatio after full collections
+  // and Remark.
+  bool is_under_memory_pressure() const;
+  void set_under_memory_pressure(bool value);
+
   static G1HeapSizingPolicy* create(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 };
 
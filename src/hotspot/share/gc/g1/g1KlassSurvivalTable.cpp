@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1KlassSurvivalTable.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+
+G1KlassSurvivalTable::G1KlassSurvivalTable() {
+  clear();
+}
+
+void G1KlassSurvivalTable::record_survivor(Klass* klass, uint age) {
+  assert(age <= 1, "only first and second survivals are sampled");
+  Entry* entry = &_entries[index_for(klass)];
+  Klass* cur = Atomic::load(&entry->_klass);
+  if (cur == nullptr) {
+    cur = Atomic::cmpxchg(&entry->_klass, (Klass*)nullptr, klass, memory_order_relaxed);
+    if (cur == nullptr) {
+      cur = klass;
+    }
+  }
+  if (cur != klass) {
+    // Collision with another class.
+    return;
+  }
+  if (age == 0) {
+    Atomic::inc(&entry->_survived_once, memory_order_relaxed);
+  } else {
+    Atomic::inc(&entry->_survived_twice, memory_order_relaxed);
+  }
+}
+
+void G1KlassSurvivalTable::update() {
+  assert_at_safepoint();
+  uint num_sampled = 0;
+  uint num_promote_early = 0;
+  for (uint i = 0; i < TableSize; i++) {
+    Entry* entry = &_entries[i];
+    if (entry->_klass == nullptr) {
+      continue;
+    }
+    // The objects copied with age 1 now are the survivors of the cohort copied
+    // with age 0 by the previous collection. Decay the older cohorts so that
+    // the decision follows changes in behavior.
+    entry->_cohort_size = entry->_cohort_size / 2 + entry->_prev_survived_once;
+    entry->_cohort_survivors = entry->_cohort_survivors / 2 + entry->_survived_twice;
+    if (entry->_cohort_size >= MinSamples) {
+      entry->_promote_early = (uint64_t)entry->_cohort_survivors * 100 >=
+                              (uint64_t)entry->_cohort_size * G1EarlyPromotionSurvivalPercent;
+    }
+    entry->_prev_survived_once = entry->_survived_once;
+    entry->_survived_once = 0;
+    entry->_survived_twice = 0;
+    if (entry->_prev_survived_once == 0 && entry->_cohort_size == 0 && entry->_cohort_survivors == 0) {
+      // Make room for other classes.
+      entry->_klass = nullptr;
+      entry->_promote_early = false;
+      continue;
+    }
+    num_sampled++;
+    num_promote_early += entry->_promote_early ? 1 : 0;
+  }
+  log_debug(gc, age)("Early promotion for %u of %u sampled classes", num_promote_early, num_sampled);
+}
+
+void G1KlassSurvivalTable::clear() {
+  for (uint i = 0; i < TableSize; i++) {
+    _entries[i]._klass = nullptr;
+    _entries[i]._survived_once = 0;
+    _entries[i]._survived_twice = 0;
+    _entries[i]._prev_survived_once = 0;
+    _entries[i]._cohort_size = 0;
+    _entries[i]._cohort_survivors = 0;
+    _entries[i]._promote_early = false;
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1KLASSSURVIVALTABLE_HPP
+#define SHARE_GC_G1_G1KLASSSURVIVALTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Klass;
+
+// Samples, per class, how many young objects survive their first and their
+// second young collection during evacuation. Objects of classes whose instances
+// mostly survive the second collection once they survived the first are likely
+// long-lived, so G1EarlyPromotion promotes them on their second survival instead
+// of copying them between survivor regions until they reach the tenuring
+// threshold.
+//
+// The objects copied with age 1 by a collection are the survivors of the
+// objects copied with age 0 by the previous collection, so each cohort is
+// compared against its own size from the previous collection.
+//
+// The table is a fixed size, direct mapped cache keyed by Klass*. Classes
+// colliding with an already recorded class are not sampled until the entry is
+// released again after its samples decayed.
+class G1KlassSurvivalTable : public CHeapObj<mtGC> {
+  struct Entry {
+    Klass* volatile _klass;
+    // Number of sampled objects copied with age 0 respectively 1 by the
+    // current collection.
+    volatile uint _survived_once;
+    volatile uint _survived_twice;
+    // Number of sampled objects copied with age 0 by the previous collection.
+    uint _prev_survived_once;
+    // Decayed sums of the cohort sizes and of their second survivals.
+    uint _cohort_size;
+    uint _cohort_survivors;
+    bool _promote_early;
+  };
+
+  static const uint LogTableSize = 10;
+  static const uint TableSize = 1u << LogTableSize;
+  // Minimum (decayed) number of sampled objects that survived their first
+  // collection before making a decision for a class.
+  static const uint MinSamples = 16;
+
+  Entry _entries[TableSize];
+
+  static uint index_for(const Klass* klass);
+
+public:
+  // Only every SampleInterval-th copied object is sampled by each worker.
+  static const uint SampleInterval = 64;
+
+  G1KlassSurvivalTable();
+
+  // Records that an object of the given klass with the given age (before this
+  // collection) is being copied. Called concurrently by the GC workers.
+  void record_survivor(Klass* klass, uint age);
+
+  // Returns whether objects of the given klass that already survived a young
+  // collection should be promoted.
+  inline bool should_promote_early(const Klass* klass) const;
+
+  // Updates the decisions from the samples of the last collection, and decays
+  // the samples. Called at the end of young collections.
+  void update();
+
+  // Forgets all samples, e.g. after classes have been unloaded.
+  void clear();
+};
+
+inline uint G1KlassSurvivalTable::index_for(const Klass* klass) {
+  // Fibonacci hashing of the Klass* without the alignment bits.
+  uint32_t h = (uint32_t)(p2i(klass) >> LogBytesPerWord);
+  return (h * 0x9E3779B1u) >> (32 - LogTableSize);
+}
+
+inline bool G1KlassSurvivalTable::should_promote_early(const Klass* klass) const {
+  const Entry* entry = &_entries[index_for(klass)];
+  return entry->_klass == klass && entry->_promote_early;
+}
+
+#endif // SHARE_GC_G1_G1KLASSSURVIVALTABLE_HPP
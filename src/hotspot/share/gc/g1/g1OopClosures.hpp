@@ -36,6 +36,7 @@ class G1RemSet;
 class G1ConcurrentMark;
 class G1CMBitMap;
 class G1ParScanThreadState;
+class G1RefinementBatch;
 class G1ScanEvacuatedObjClosure;
 class G1CMTask;
 class ReferenceProcessor;
@@ -205,12 +206,12 @@ class G1RootRegionScanClosure : public ClaimMetadataVisitingOopIterateClosure {
 
 class G1ConcurrentRefineOopClosure: public BasicOopIterateClosure {
   G1CollectedHeap* _g1h;
-  uint _worker_id;
+  G1RefinementBatch* _batch;
 
 public:
-  G1ConcurrentRefineOopClosure(G1CollectedHeap* g1h, uint worker_id) :
+  G1ConcurrentRefineOopClosure(G1CollectedHeap* g1h, G1RefinementBatch* batch) :
     _g1h(g1h),
-    _worker_id(worker_id) {
+    _batch(batch) {
   }
 
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
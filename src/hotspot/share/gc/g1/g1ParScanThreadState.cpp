@@ -27,6 +27,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1EvacFailureRegions.inline.hpp"
+#include "gc/g1/g1KlassSurvivalTable.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1RootClosures.hpp"
@@ -69,6 +70,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _plab_allocator(nullptr),
     _age_table(false),
     _tenuring_threshold(g1h->policy()->tenuring_threshold()),
+    _klass_survival_table(g1h->klass_survival_table()),
+    _survival_sample_counter(0),
     _scanner(g1h, this),
     _worker_id(worker_id),
     _last_enqueued_card(SIZE_MAX),
@@ -300,6 +303,54 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task) {
   }
 }
 
+template <class T>
+inline void G1ParScanThreadState::prefetch_referent(T* p) {
+  // The header line holds both the mark word and the klass, the first
+  // things do_oop_evac() and the copy look at. Prefetching never faults, so
+  // a referent that has been concurrently changed by another thread is fine.
+  oop obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+  Prefetch::read(cast_from_oop<void*>(obj), 0);
+}
+
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::prefetch_task(ScannerTask task) {
+  if (task.is_narrow_oop_ptr()) {
+    prefetch_referent(task.to_narrow_oop_ptr());
+  } else if (task.is_oop_ptr()) {
+    prefetch_referent(task.to_oop_ptr());
+  }
+  // Partial array tasks refer to an already copied array; nothing to prefetch.
+}
+
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::trim_local_queue_prefetching(uint threshold) {
+  const uint distance = G1EvacuationPrefetchDistance;
+  assert(distance > 0 && distance <= MaxEvacuationPrefetchDistance, "invalid prefetch distance %u", distance);
+
+  // Ring buffer of popped tasks whose referents are being prefetched.
+  ScannerTask in_flight[MaxEvacuationPrefetchDistance];
+  uint head = 0;
+  uint num_in_flight = 0;
+
+  ScannerTask task;
+  while (true) {
+    while (num_in_flight < distance && _task_queue->pop_local(task, threshold)) {
+      prefetch_task(task);
+      uint tail = head + num_in_flight;
+      in_flight[tail < distance ? tail : tail - distance] = task;
+      num_in_flight++;
+    }
+    if (num_in_flight == 0) {
+      break;
+    }
+    task = in_flight[head];
+    head = (head + 1 < distance) ? head + 1 : 0;
+    num_in_flight--;
+    // Tasks pushed by this one refill the ring on the next iteration.
+    dispatch_task(task);
+  }
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
@@ -312,8 +363,13 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
         dispatch_task(task);
       }
     }
-    while (_task_queue->pop_local(task, threshold)) {
-      dispatch_task(task);
+    // Keep a separate loop without prefetching, see prefetch.hpp.
+    if (G1EvacuationPrefetchDistance > 0) {
+      trim_local_queue_prefetching(threshold);
+    } else {
+      while (_task_queue->pop_local(task, threshold)) {
+        dispatch_task(task);
+      }
     }
   } while (!_task_queue->overflow_empty());
 }
@@ -368,12 +424,20 @@ HeapWord* G1ParScanThreadState::allocate_in_next_plab(G1HeapRegionAttr* dest,
   }
 }
 
-G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age) {
+G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age) {
   assert(region_attr.is_young() || region_attr.is_old(), "must be either Young or Old");
 
   if (region_attr.is_young()) {
     age = !m.has_displaced_mark_helper() ? m.age()
                                          : m.displaced_mark_helper().age();
+    if (_klass_survival_table != nullptr && age <= 1) {
+      if ((++_survival_sample_counter % G1KlassSurvivalTable::SampleInterval) == 0) {
+        _klass_survival_table->record_survivor(klass, age);
+      }
+      if (age == 1 && _klass_survival_table->should_promote_early(klass)) {
+        return G1HeapRegionAttr::Old;
+      }
+    }
     if (age < _tenuring_threshold) {
       return region_attr;
     }
@@ -461,9 +525,15 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   Klass* klass = old->klass();
   const size_t word_sz = old->size_given_klass(klass);
 
-  uint age = 0;
-  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  // Objects in regions with pinned objects must not move. Only young regions
+  // with pinned objects can be in the collection set.
+  if (from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark, word_sz, true /* cause_pinned */);
+  }
+
+  uint age = 0;
+  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, klass, age);
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -475,7 +545,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     if (obj_ptr == nullptr) {
       // This will either forward-to-self, or detect that someone else has
       // installed a forwarding pointer.
-      return handle_evacuation_failure_par(old, old_mark, word_sz);
+      return handle_evacuation_failure_par(old, old_mark, word_sz, false /* cause_pinned */);
     }
   }
 
@@ -487,7 +557,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     // Doing this after all the allocation attempts also tests the
     // undo_allocation() method too.
     undo_allocation(dest_attr, obj_ptr, word_sz, node_index);
-    return handle_evacuation_failure_par(old, old_mark, word_sz);
+    return handle_evacuation_failure_par(old, old_mark, word_sz, false /* cause_pinned */);
   }
 
   // We're going to allocate linearly, so might as well prefetch ahead.
@@ -624,7 +694,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
 }
 
 NOINLINE
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz, bool cause_pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -632,7 +702,7 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
     // Forward-to-self succeeded. We are the "owner" of the object.
     HeapRegion* r = _g1h->heap_region_containing(old);
 
-    if (_evac_failure_regions->record(r->hrm_index())) {
+    if (_evac_failure_regions->record(r->hrm_index(), cause_pinned)) {
       _g1h->hr_printer()->evac_failure(r);
     }
 
@@ -644,7 +714,9 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
 
     ContinuationGCSupport::transform_stack_chunk(old);
 
-    _evacuation_failed_info.register_copy_failure(word_sz);
+    if (!cause_pinned) {
+      _evacuation_failed_info.register_copy_failure(word_sz);
+    }
 
     // For iterating objects that failed evacuation currently we can reuse the
     // existing closure to scan evacuated objects; since we are iterating from a
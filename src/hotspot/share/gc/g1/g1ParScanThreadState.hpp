@@ -44,6 +44,7 @@ class G1CardTable;
 class G1CollectionSet;
 class G1EvacFailureRegions;
 class G1EvacuationRootClosures;
+class G1KlassSurvivalTable;
 class G1OopStarChunkedList;
 class G1PLABAllocator;
 class HeapRegion;
@@ -63,6 +64,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   AgeTable _age_table;
   // Local tenuring threshold.
   uint _tenuring_threshold;
+  // Survival samples for G1EarlyPromotion, null if disabled.
+  G1KlassSurvivalTable* _klass_survival_table;
+  uint _survival_sample_counter;
   G1ScanEvacuatedObjClosure _scanner;
 
   uint _worker_id;
@@ -194,6 +198,12 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   void dispatch_task(ScannerTask task);
 
+  // Maximum value of G1EvacuationPrefetchDistance.
+  static const uint MaxEvacuationPrefetchDistance = 16;
+
+  template <class T> inline void prefetch_referent(T* p);
+  void prefetch_task(ScannerTask task);
+
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. Previous_plab_refill_failed indicates whether previous
   // PLAB refill for the original (source) object failed.
@@ -205,13 +215,18 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                                   bool previous_plab_refill_failed,
                                   uint node_index);
 
-  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age);
+  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age);
 
   void report_promotion_event(G1HeapRegionAttr const dest_attr,
                               oop const old, size_t word_sz, uint age,
                               HeapWord * const obj_ptr, uint node_index) const;
 
   void trim_queue_to_threshold(uint threshold);
+  // Like popping and dispatching tasks from the local queue until it contains
+  // no more than threshold entries, but keeps up to G1EvacuationPrefetchDistance
+  // popped tasks in flight to hide the latency of the first access to their
+  // referents.
+  void trim_local_queue_prefetching(uint threshold);
 
   inline bool needs_partial_trimming() const;
 
@@ -230,8 +245,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
 
-  // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz);
+  // An attempt to evacuate "obj" has failed; take necessary steps. cause_pinned
+  // indicates that "obj" has not been copied because its region has pinned objects.
+  oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz, bool cause_pinned);
 
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
@@ -27,14 +27,101 @@
 #include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
 #include "gc/g1/g1GCCounters.hpp"
+#include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
+
+static bool is_container_under_memory_pressure() {
+#ifdef LINUX
+  if (!OSContainer::is_containerized()) {
+    return false;
+  }
+  // Negative values mean that memory pressure is not supported by the
+  // cgroup subsystem.
+  double pressure = OSContainer::memory_pressure();
+  if (pressure >= G1PeriodicGCMemoryPressureThreshold) {
+    log_debug(gc, periodic)("Memory pressure %1.2f%% is at or above threshold %1.2f%%.",
+                            pressure, G1PeriodicGCMemoryPressureThreshold);
+    return true;
+  }
+  jlong throttle_limit = OSContainer::memory_throttle_limit_in_bytes();
+  if (throttle_limit > 0) {
+    jlong usage = OSContainer::memory_usage_in_bytes();
+    if (usage >= throttle_limit) {
+      log_debug(gc, periodic)("Memory usage " JLONG_FORMAT "B is at or above throttle limit " JLONG_FORMAT "B.",
+                              usage, throttle_limit);
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+bool G1PeriodicGCTask::update_memory_pressure(G1CollectedHeap* g1h) {
+  bool memory_pressure = (G1PeriodicGCMemoryPressureThreshold > 0.0) &&
+                         is_container_under_memory_pressure();
+
+  G1HeapSizingPolicy* heap_sizing_policy = g1h->heap_sizing_policy();
+  if (memory_pressure != heap_sizing_policy->is_under_memory_pressure()) {
+    log_info(gc, periodic)("Container memory pressure %s.", memory_pressure ? "detected" : "relieved");
+    heap_sizing_policy->set_under_memory_pressure(memory_pressure);
+    _capacity_at_memory_pressure_gc = 0;
+  }
+  return memory_pressure;
+}
+
+bool G1PeriodicGCTask::update_idle_state(G1CollectedHeap* g1h) {
+  if (G1PeriodicGCIdleInterval == 0) {
+    return false;
+  }
+  // Mutator allocation regions are only accounted in the unlocked used
+  // value once they retire, so this detects about a region's worth of
+  // allocation between samples, which is enough to tell busy from idle.
+  // A young GC lowers the usage, so an application that allocates and
+  // collects between two samples may show no growth; any collection other
+  // than the one requested by this task therefore also counts as activity.
+  // The requested GC is a full GC or a concurrent cycle, which counts a
+  // collection for both its concurrent start and remark pauses, so the
+  // collections are attributed to it until that cycle has finished.
+  size_t used = g1h->used_unlocked();
+  uint collections = g1h->total_collections();
+  bool collected = collections != _collections_at_idle_sample;
+  if (_own_gc_pending && collected) {
+    collected = false;
+    if (!g1h->concurrent_mark()->cm_thread()->in_progress()) {
+      _own_gc_pending = false;
+    }
+  }
+  jlong now_ms = os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
+  if (used > _used_at_idle_sample || collected || _idle_start_ms == 0) {
+    _idle_start_ms = now_ms;
+    _idle_gc_requested = false;
+  }
+  _used_at_idle_sample = used;
+  _collections_at_idle_sample = collections;
+
+  if (_idle_gc_requested) {
+    return false;
+  }
+  jlong idle_ms = now_ms - _idle_start_ms;
+  if (idle_ms < (jlong)G1PeriodicGCIdleInterval) {
+    return false;
+  }
+  log_debug(gc, periodic)("No allocation for " JLONG_FORMAT "ms which is at or above threshold " UINTX_FORMAT "ms.",
+                          idle_ms, G1PeriodicGCIdleInterval);
+  return true;
+}
 
 bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
+                                                bool memory_pressure,
+                                                bool idle,
                                                 G1GCCounters* counters) {
   // Ensure no GC safepoints while we're doing the checks, to avoid data races.
   SuspendibleThreadSetJoiner sts;
@@ -45,12 +132,30 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
     return false;
   }
 
-  // Check if enough time has passed since the last GC.
-  uintx time_since_last_gc = (uintx)g1h->time_since_last_collection().milliseconds();
-  if ((time_since_last_gc < G1PeriodicGCInterval)) {
-    log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
-                            time_since_last_gc, G1PeriodicGCInterval);
-    return false;
+  // Under memory pressure collect regardless of time since the last GC and
+  // system load, but only once unless the heap has grown since; the heap
+  // sizing policy keeps it from growing again after young collections.
+  if (memory_pressure && g1h->capacity() > _capacity_at_memory_pressure_gc) {
+    log_debug(gc, periodic)("Container under memory pressure with heap capacity " SIZE_FORMAT "B.",
+                            g1h->capacity());
+    *counters = G1GCCounters(g1h);
+    return true;
+  }
+
+  // An idle heap is collected regardless of the time since the last GC.
+  if (!idle) {
+    if (G1PeriodicGCInterval == 0) {
+      log_debug(gc, periodic)("Periodic GC disabled. Skipping.");
+      return false;
+    }
+
+    // Check if enough time has passed since the last GC.
+    uintx time_since_last_gc = (uintx)g1h->time_since_last_collection().milliseconds();
+    if ((time_since_last_gc < G1PeriodicGCInterval)) {
+      log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
+                              time_since_last_gc, G1PeriodicGCInterval);
+      return false;
+    }
   }
 
   // Check if load is lower than max.
@@ -70,23 +175,39 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
 }
 
 void G1PeriodicGCTask::check_for_periodic_gc() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  bool memory_pressure = update_memory_pressure(g1h);
+  bool idle = update_idle_state(g1h);
+
   // If disabled, just return.
-  if (G1PeriodicGCInterval == 0) {
+  if (G1PeriodicGCInterval == 0 && !memory_pressure && !idle) {
     return;
   }
 
   log_debug(gc, periodic)("Checking for periodic GC.");
-  G1CollectedHeap* g1h = G1CollectedHeap::heap();
   G1GCCounters counters;
-  if (should_start_periodic_gc(g1h, &counters)) {
+  if (should_start_periodic_gc(g1h, memory_pressure, idle, &counters)) {
     if (!g1h->try_collect(GCCause::_g1_periodic_collection, counters)) {
       log_debug(gc, periodic)("GC request denied. Skipping.");
+    } else {
+      if (memory_pressure) {
+        _capacity_at_memory_pressure_gc = g1h->capacity();
+      }
+      // Collect only once per idle period, whatever triggered the GC.
+      _idle_gc_requested = true;
+      _own_gc_pending = true;
     }
   }
 }
 
 G1PeriodicGCTask::G1PeriodicGCTask(const char* name) :
-  G1ServiceTask(name) { }
+  G1ServiceTask(name),
+  _capacity_at_memory_pressure_gc(0),
+  _used_at_idle_sample(0),
+  _collections_at_idle_sample(0),
+  _idle_start_ms(0),
+  _idle_gc_requested(false),
+  _own_gc_pending(false) { }
 
 void G1PeriodicGCTask::execute() {
   check_for_periodic_gc();
@@ -94,5 +215,10 @@ void G1PeriodicGCTask::execute() {
   // during runtime. If no value is set, wait a second and run it
   // again to see if the value has been updated. Otherwise use the
   // real value provided.
-  schedule(G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval);
+  uintx delay_ms = G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval;
+  // Sample memory pressure and heap allocation at least every second.
+  if (G1PeriodicGCMemoryPressureThreshold > 0.0 || G1PeriodicGCIdleInterval > 0) {
+    delay_ms = MIN2(delay_ms, (uintx)1000);
+  }
+  schedule(delay_ms);
 }
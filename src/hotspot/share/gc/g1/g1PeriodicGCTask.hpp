@@ -32,7 +32,33 @@ class G1GCCounters;
 
 // Task handling periodic GCs
 class G1PeriodicGCTask : public G1ServiceTask {
+  // Heap capacity when the last GC because of memory pressure has been
+  // requested, or zero if there has been none during the current period
+  // of memory pressure.
+  size_t _capacity_at_memory_pressure_gc;
+
+  // Idle detection state: heap usage and number of collections at the last
+  // sample, the time at which the heap was last seen busy, whether a GC has
+  // already been requested for the current idle period, and whether the
+  // GC requested by this task may still add to the number of collections.
+  size_t _used_at_idle_sample;
+  uint _collections_at_idle_sample;
+  jlong _idle_start_ms;
+  bool _idle_gc_requested;
+  bool _own_gc_pending;
+
+  // Samples container memory pressure and updates the heap sizing policy.
+  // Returns whether the container is under memory pressure.
+  bool update_memory_pressure(G1CollectedHeap* g1h);
+
+  // Samples heap usage and the number of collections. Returns whether the
+  // heap has seen no allocation for G1PeriodicGCIdleInterval and no GC was
+  // requested for this idle period yet.
+  bool update_idle_state(G1CollectedHeap* g1h);
+
   bool should_start_periodic_gc(G1CollectedHeap* g1h,
+                                bool memory_pressure,
+                                bool idle,
                                 G1GCCounters* counters);
   void check_for_periodic_gc();
 
@@ -38,6 +38,7 @@
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -182,6 +183,11 @@ uint G1Policy::calculate_desired_eden_length_by_mmu() const {
   double now_sec = os::elapsedTime();
   double when_ms = _mmu_tracker->when_max_gc_sec(now_sec) * 1000.0;
   double alloc_rate_ms = _analytics->predict_alloc_rate_ms();
+  if (G1UseAllocationRateForecast) {
+    // Anticipate a rising allocation rate instead of waiting for the average
+    // to catch up with it.
+    alloc_rate_ms = MAX2(alloc_rate_ms, _analytics->forecast_alloc_rate_ms());
+  }
   return (uint) ceil(alloc_rate_ms * when_ms);
 }
 
@@ -655,6 +661,12 @@ void G1Policy::record_concurrent_refinement_stats(size_t pending_cards,
 }
 
 bool G1Policy::should_retain_evac_failed_region(uint index) const {
+  // Always retain regions with pinned objects: their objects can be evacuated
+  // as soon as they are unpinned.
+  if (_g1h->region_at(index)->has_pinned_objects()) {
+    return true;
+  }
+
   size_t live_bytes= _g1h->region_at(index)->live_bytes();
 
   assert(live_bytes != 0,
@@ -823,7 +835,9 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     // place we can safely ignore them here.
     uint regions_allocated = _collection_set->eden_region_length();
     double alloc_rate_ms = (double) regions_allocated / app_time_ms;
+    double forecast_alloc_rate_ms = _analytics->forecast_alloc_rate_ms();
     _analytics->report_alloc_rate_ms(alloc_rate_ms);
+    report_alloc_rate_forecast(forecast_alloc_rate_ms, alloc_rate_ms);
   }
 
   record_pause(this_pause, start_time_sec, end_time_sec, evacuation_failure);
@@ -1038,6 +1052,19 @@ void G1Policy::update_ihop_prediction(double mutator_time_s,
   }
 }
 
+void G1Policy::report_alloc_rate_forecast(double forecast_alloc_rate_ms, double alloc_rate_ms) {
+  // Convert from regions/ms to bytes/s.
+  double region_rate_to_bytes = (double)HeapRegion::GrainBytes * MILLIUNITS;
+  double predicted = forecast_alloc_rate_ms * region_rate_to_bytes;
+  double actual = alloc_rate_ms * region_rate_to_bytes;
+  log_debug(gc, ergo, heap)("Allocation rate forecast: predicted %.1fB/s actual %.1fB/s",
+                            predicted, actual);
+  _g1h->gc_tracer_stw()->report_alloc_rate_forecast(predicted,
+                                                    actual,
+                                                    _analytics->forecast_alloc_rate_ms() * region_rate_to_bytes,
+                                                    G1UseAllocationRateForecast);
+}
+
 void G1Policy::report_ihop_statistics() {
   _ihop_control->print();
 }
@@ -1477,7 +1504,8 @@ static void print_finish_message(const char* reason, bool from_marking) {
 double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marking_list,
                                                 double time_remaining_ms,
                                                 G1CollectionCandidateRegionList* initial_old_regions,
-                                                G1CollectionCandidateRegionList* optional_old_regions) {
+                                                G1CollectionCandidateRegionList* optional_old_regions,
+                                                G1CollectionCandidateRegionList* pinned_old_regions) {
   assert(marking_list != nullptr, "must be");
 
   uint num_expensive_regions = 0;
@@ -1508,6 +1536,13 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
       break;
     }
     HeapRegion* hr = *iter;
+    if (hr->has_pinned_objects()) {
+      // The region can not be evacuated now. It is moved to the retained regions
+      // to be reconsidered in later collections.
+      log_trace(gc, ergo, cset)("Marking candidate %u has pinned objects. Skipping.", hr->hrm_index());
+      pinned_old_regions->append(hr);
+      continue;
+    }
     double predicted_time_ms = predict_region_total_time_ms(hr, false);
     time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
     // Add regions to old set until we reach the minimum amount
@@ -1551,9 +1586,9 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
                               num_expensive_regions);
   }
 
-  log_debug(gc, ergo, cset)("Finish adding marking candidates to collection set. Initial: %u, optional: %u, "
+  log_debug(gc, ergo, cset)("Finish adding marking candidates to collection set. Initial: %u, optional: %u, pinned: %u, "
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2fms",
-                            num_initial_regions_selected, num_optional_regions_selected,
+                            num_initial_regions_selected, num_optional_regions_selected, pinned_old_regions->length(),
                             predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms);
 
   assert(initial_old_regions->length() == num_initial_regions_selected, "must be");
@@ -1571,6 +1606,7 @@ void G1Policy::select_candidates_from_retained(G1CollectionCandidateList* retain
   uint num_initial_regions_selected = 0;
   uint num_optional_regions_selected = 0;
   uint num_expensive_regions_selected = 0;
+  uint num_pinned_regions = 0;
 
   double predicted_initial_time_ms = 0.0;
   double predicted_optional_time_ms = 0.0;
@@ -1589,6 +1625,12 @@ void G1Policy::select_candidates_from_retained(G1CollectionCandidateList* retain
                             min_regions, time_remaining_ms, optional_time_remaining_ms);
 
   for (HeapRegion* r : *retained_list) {
+    if (r->has_pinned_objects()) {
+      // Keep the region in the retained list until it is unpinned.
+      log_trace(gc, ergo, cset)("Retained candidate %u has pinned objects. Skipping.", r->hrm_index());
+      num_pinned_regions++;
+      continue;
+    }
     double predicted_time_ms = predict_region_total_time_ms(r, collector_state()->in_young_only_phase());
     bool fits_in_remaining_time = predicted_time_ms <= time_remaining_ms;
 
@@ -1612,7 +1654,7 @@ void G1Policy::select_candidates_from_retained(G1CollectionCandidateList* retain
   }
 
   uint num_regions_selected = num_initial_regions_selected + num_optional_regions_selected;
-  if (num_regions_selected == retained_list->length()) {
+  if (num_regions_selected + num_pinned_regions == retained_list->length()) {
     log_debug(gc, ergo, cset)("Retained candidates exhausted.");
   }
   if (num_expensive_regions_selected > 0) {
@@ -1620,10 +1662,10 @@ void G1Policy::select_candidates_from_retained(G1CollectionCandidateList* retain
                               num_expensive_regions_selected);
   }
 
-  log_debug(gc, ergo, cset)("Finish adding retained candidates to collection set. Initial: %u, optional: %u, "
+  log_debug(gc, ergo, cset)("Finish adding retained candidates to collection set. Initial: %u, optional: %u, pinned: %u, "
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, "
                             "time remaining: %1.2fms optional time remaining %1.2fms",
-                            num_initial_regions_selected, num_optional_regions_selected,
+                            num_initial_regions_selected, num_optional_regions_selected, num_pinned_regions,
                             predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms, optional_time_remaining_ms);
 }
 
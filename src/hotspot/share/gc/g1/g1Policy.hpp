@@ -65,6 +65,9 @@ class G1Policy: public CHeapObj<mtGC> {
   void update_ihop_prediction(double mutator_time_s,
                               bool this_gc_was_young_only);
   void report_ihop_statistics();
+  // Report the allocation rate forecast made at the previous pause together
+  // with the allocation rate actually observed since then.
+  void report_alloc_rate_forecast(double forecast_alloc_rate_ms, double alloc_rate_ms);
 
   G1Predictions _predictor;
   G1Analytics* _analytics;
@@ -336,12 +339,14 @@ class G1Policy: public CHeapObj<mtGC> {
   // Amount of allowed waste in bytes in the collection set.
   size_t allowed_waste_in_collection_set() const;
   // Calculate and fill in the initial and optional old gen candidate regions from
-  // the given candidate list and the remaining time.
+  // the given candidate list and the remaining time. Candidates with pinned objects
+  // are not selected but added to pinned_old_regions.
   // Returns the remaining time.
   double select_candidates_from_marking(G1CollectionCandidateList* marking_list,
                                         double time_remaining_ms,
                                         G1CollectionCandidateRegionList* initial_old_regions,
-                                        G1CollectionCandidateRegionList* optional_old_regions);
+                                        G1CollectionCandidateRegionList* optional_old_regions,
+                                        G1CollectionCandidateRegionList* pinned_old_regions);
 
   void select_candidates_from_retained(G1CollectionCandidateList* retained_list,
                                        double time_remaining_ms,
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1RefinementBatch.inline.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionRemSet.inline.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/quickSort.hpp"
+
+G1RefinementBatch::G1RefinementBatch(G1CollectedHeap* g1h, uint worker_id) :
+  _g1h(g1h),
+  _worker_id(worker_id),
+  _num_entries(0) { }
+
+G1RefinementBatch::~G1RefinementBatch() {
+  assert(_num_entries == 0, "must have been flushed");
+}
+
+int G1RefinementBatch::compare_entries(const Entry& e1, const Entry& e2) {
+  if (e1._region_idx != e2._region_idx) {
+    return e1._region_idx < e2._region_idx ? -1 : 1;
+  }
+  if (e1._card != e2._card) {
+    return e1._card < e2._card ? -1 : 1;
+  }
+  return 0;
+}
+
+void G1RefinementBatch::flush() {
+  if (_num_entries == 0) {
+    return;
+  }
+  // Sorting by card within a region groups the cards by card region, as
+  // required by G1CardSet::add_cards().
+  QuickSort::sort(_entries, _num_entries, compare_entries, false);
+
+  uintptr_t cards[Capacity];
+  uint i = 0;
+  while (i < _num_entries) {
+    const uint region_idx = _entries[i]._region_idx;
+    size_t num_cards = 0;
+    for (; i < _num_entries && _entries[i]._region_idx == region_idx; i++) {
+      // The from card cache does not filter all duplicates.
+      if (num_cards == 0 || cards[num_cards - 1] != _entries[i]._card) {
+        cards[num_cards++] = _entries[i]._card;
+      }
+    }
+    _g1h->region_at(region_idx)->rem_set()->add_cards(cards, num_cards);
+  }
+  _num_entries = 0;
+}
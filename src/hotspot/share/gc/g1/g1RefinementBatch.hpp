@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1REFINEMENTBATCH_HPP
+#define SHARE_GC_G1_G1REFINEMENTBATCH_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1CollectedHeap;
+class HeapRegion;
+
+// Collects the remembered set entries found while refining a buffer of cards,
+// and adds them to the remembered sets grouped by target region and card region.
+// Compared to adding every entry right away this reduces the number of card set
+// container lookups, reference count updates and occupancy counter updates,
+// which all are contended atomic operations when many refining threads find
+// references into the same regions.
+//
+// The batch must be flushed before refinement yields to a safepoint.
+class G1RefinementBatch : public StackObj {
+  struct Entry {
+    uint _region_idx;
+    uintptr_t _card;
+  };
+
+  static const uint Capacity = 256;
+
+  G1CollectedHeap* _g1h;
+  uint _worker_id;
+  uint _num_entries;
+  Entry _entries[Capacity];
+
+  static int compare_entries(const Entry& e1, const Entry& e2);
+
+public:
+  G1RefinementBatch(G1CollectedHeap* g1h, uint worker_id);
+  ~G1RefinementBatch();
+
+  // Records the reference from into the given region, unless filtered out by
+  // the from card cache.
+  inline void add_reference(HeapRegion* to, OopOrNarrowOopStar from);
+
+  // Adds all recorded entries to the remembered sets.
+  void flush();
+};
+
+#endif // SHARE_GC_G1_G1REFINEMENTBATCH_HPP
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1REFINEMENTBATCH_INLINE_HPP
+#define SHARE_GC_G1_G1REFINEMENTBATCH_INLINE_HPP
+
+#include "gc/g1/g1RefinementBatch.hpp"
+
+#include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegionRemSet.inline.hpp"
+
+inline void G1RefinementBatch::add_reference(HeapRegion* to, OopOrNarrowOopStar from) {
+  HeapRegionRemSet* rem_set = to->rem_set();
+  if (!rem_set->should_add_reference(from, _worker_id)) {
+    return;
+  }
+  if (_num_entries == Capacity) {
+    flush();
+  }
+  Entry* entry = &_entries[_num_entries++];
+  entry->_region_idx = to->hrm_index();
+  entry->_card = rem_set->to_card(from);
+}
+
+#endif // SHARE_GC_G1_G1REFINEMENTBATCH_INLINE_HPP
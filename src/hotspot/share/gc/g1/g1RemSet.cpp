@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -564,58 +566,68 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
-    CardValue* find_first_dirty_card(CardValue* i_card) const {
+    // Number of words that are checked at once when skipping long runs of
+    // clean or dirty cards. The loop over a block has no early exit, so the
+    // compiler can vectorize it.
+    static const uint WordsPerBlock = 4;
+    static const size_t BlockSize = WordsPerBlock * sizeof(Word);
+
+    // Returns a word that has bit 0 of every byte set for which the corresponding
+    // card is dirty (find_dirty) or not dirty (!find_dirty).
+    template <bool find_dirty>
+    static Word cards_to_find(Word word_value) {
+      return (find_dirty ? ~word_value : word_value) & ExpandedToScanMask;
+    }
+
+    // Offset of the first card in the word that cards_to_find() marked.
+    static uint first_card_offset(Word marked_cards) {
+      assert(marked_cards != 0, "precondition");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(marked_cards) / BitsPerByte;
+#else
+      return count_leading_zeros(marked_cards) / BitsPerByte;
+#endif
+    }
+
+    template <bool find_dirty>
+    CardValue* find_first_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
-        if (is_card_dirty(i_card)) {
+        if (is_card_dirty(i_card) == find_dirty) {
           return i_card;
         }
         i_card++;
       }
 
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+      while (pointer_delta(_end_card, i_card, sizeof(CardValue)) >= BlockSize) {
+        const Word* words = reinterpret_cast<const Word*>(i_card);
+        Word marked_cards = 0;
+        for (uint i = 0; i < WordsPerBlock; ++i) {
+          marked_cards |= cards_to_find<find_dirty>(words[i]);
         }
-      }
-
-      return _end_card;
-    }
-
-    CardValue* find_first_non_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (!is_card_dirty(i_card)) {
-          return i_card;
+        if (marked_cards != 0) {
+          break;
         }
-        i_card++;
+        i_card += BlockSize;
       }
 
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word marked_cards = cards_to_find<find_dirty>(*reinterpret_cast<Word*>(i_card));
+        if (marked_cards != 0) {
+          return i_card + first_card_offset(marked_cards);
         }
       }
 
       return _end_card;
     }
 
+    CardValue* find_first_dirty_card(CardValue* i_card) const {
+      return find_first_card<true /* find_dirty */>(i_card);
+    }
+
+    CardValue* find_first_non_dirty_card(CardValue* i_card) const {
+      return find_first_card<false /* find_dirty */>(i_card);
+    }
+
   public:
     ChunkScanner(CardValue* const start_card, CardValue* const end_card) :
       _start_card(start_card),
@@ -1514,7 +1526,7 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
 }
 
 void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
-                                        const uint worker_id) {
+                                        G1RefinementBatch* batch) {
   assert(!_g1h->is_gc_active(), "Only call concurrently");
   check_card_ptr(card_ptr, _ct);
 
@@ -1537,7 +1549,7 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   MemRegion dirty_region(start, MIN2(scan_limit, end));
   assert(!dirty_region.is_empty(), "sanity");
 
-  G1ConcurrentRefineOopClosure conc_refine_cl(_g1h, worker_id);
+  G1ConcurrentRefineOopClosure conc_refine_cl(_g1h, batch);
   if (r->oops_on_memregion_seq_iterate_careful<false>(dirty_region, &conc_refine_cl) != nullptr) {
     return;
   }
@@ -47,6 +47,7 @@ class G1RemSetScanState;
 class G1ParScanThreadState;
 class G1ParScanThreadStateSet;
 class G1Policy;
+class G1RefinementBatch;
 class G1RemSetSamplingTask;
 class G1ScanCardClosure;
 class G1ServiceThread;
@@ -126,9 +127,10 @@ class G1RemSet: public CHeapObj<mtGC> {
   bool clean_card_before_refine(CardValue** const card_ptr_addr);
   // Refine the region corresponding to "card_ptr". Must be called after
   // being filtered by clean_card_before_refine(), and after proper
-  // fence/synchronization.
+  // fence/synchronization. The remembered set entries found are recorded
+  // in the given batch.
   void refine_card_concurrently(CardValue* const card_ptr,
-                                const uint worker_id);
+                                G1RefinementBatch* batch);
 
   // Print accumulated summary info from the start of the VM.
   void print_summary_info();
@@ -192,6 +192,8 @@ class HRRSStatsIter: public HeapRegionClosure {
   size_t _max_rs_mem_sz;
   HeapRegion* _max_rs_mem_sz_region;
 
+  size_t _rs_saved_mem_sz;
+
   size_t total_rs_unused_mem_sz() const     { return _all.rs_unused_mem_size(); }
   size_t total_rs_mem_sz() const            { return _all.rs_mem_size(); }
   size_t total_cards_occupied() const       { return _all.cards_occupied(); }
@@ -212,6 +214,7 @@ class HRRSStatsIter: public HeapRegionClosure {
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(nullptr),
+    _rs_saved_mem_sz(0),
     _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr)
   {}
 
@@ -222,6 +225,7 @@ class HRRSStatsIter: public HeapRegionClosure {
     // size of the code roots
     size_t rs_unused_mem_sz = hrrs->unused_mem_size();
     size_t rs_mem_sz = hrrs->mem_size();
+    _rs_saved_mem_sz += hrrs->small_array_saved_mem_size();
     if (rs_mem_sz > _max_rs_mem_sz) {
       _max_rs_mem_sz = rs_mem_sz;
       _max_rs_mem_sz_region = r;
@@ -263,6 +267,7 @@ class HRRSStatsIter: public HeapRegionClosure {
                   total_rs_mem_sz(),
                   max_rs_mem_sz(),
                   total_rs_unused_mem_sz());
+    out->print_cr("  Saved by small card arrays = " SIZE_FORMAT, _rs_saved_mem_sz);
     for (RegionTypeCounter** current = &counters[0]; *current != nullptr; current++) {
       (*current)->print_rs_mem_info_on(out, total_rs_mem_sz());
     }
@@ -127,6 +127,16 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_alloc_rate_forecast(double predicted_allocation_rate,
+                                             double actual_allocation_rate,
+                                             double next_predicted_allocation_rate,
+                                             bool forecast_active) {
+  send_alloc_rate_forecast(predicted_allocation_rate,
+                           actual_allocation_rate,
+                           next_predicted_allocation_rate,
+                           forecast_active);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -248,6 +258,21 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_alloc_rate_forecast(double predicted_allocation_rate,
+                                           double actual_allocation_rate,
+                                           double next_predicted_allocation_rate,
+                                           bool forecast_active) {
+  EventG1AllocationRateForecast evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_predictedAllocationRate(predicted_allocation_rate);
+    evt.set_actualAllocationRate(actual_allocation_rate);
+    evt.set_nextPredictedAllocationRate(next_predicted_allocation_rate);
+    evt.set_forecastActive(forecast_active);
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
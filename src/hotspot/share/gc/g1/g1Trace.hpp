@@ -63,6 +63,10 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_alloc_rate_forecast(double predicted_allocation_rate,
+                                  double actual_allocation_rate,
+                                  double next_predicted_allocation_rate,
+                                  bool forecast_active);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +88,10 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_alloc_rate_forecast(double predicted_allocation_rate,
+                                double actual_allocation_rate,
+                                double next_predicted_allocation_rate,
+                                bool forecast_active);
 };
 
 class G1OldTracer : public OldGCTracer, public CHeapObj<mtGC> {
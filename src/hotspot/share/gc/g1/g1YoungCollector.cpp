@@ -37,6 +37,7 @@
 #include "gc/g1/g1YoungGCEvacFailureInjector.hpp"
 #include "gc/g1/g1EvacInfo.hpp"
 #include "gc/g1/g1HRPrinter.hpp"
+#include "gc/g1/g1KlassSurvivalTable.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
@@ -77,12 +78,19 @@ class G1YoungGCTraceTime {
   GCTraceTime(Info, gc) _tt;
 
   const char* update_young_gc_name() {
+    const char* evac_failure_str = "";
+    if (_collector->evacuation_alloc_failed()) {
+      evac_failure_str = _collector->evacuation_pinned() ? " (Evacuation Failure: Allocation/Pinned)"
+                                                         : " (Evacuation Failure: Allocation)";
+    } else if (_collector->evacuation_pinned()) {
+      evac_failure_str = " (Evacuation Failure: Pinned)";
+    }
     snprintf(_young_gc_name_data,
              MaxYoungGCNameLength,
              "Pause Young (%s) (%s)%s",
              G1GCPauseTypeHelper::to_string(_pause_type),
              GCCause::to_string(_pause_cause),
-             _collector->evacuation_failed() ? " (Evacuation Failure)" : "");
+             evac_failure_str);
     return _young_gc_name_data;
   }
 
@@ -350,7 +358,10 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
+      // Pinned objects must not be reclaimed even if they are not referenced
+      // from the Java heap.
       return obj->is_typeArray() &&
+             !region->has_pinned_objects() &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
@@ -759,7 +770,7 @@ void G1YoungCollector::evacuate_next_optional_regions(G1ParScanThreadStateSet* p
 void G1YoungCollector::evacuate_optional_collection_set(G1ParScanThreadStateSet* per_thread_states) {
   const double collection_start_time_ms = phase_times()->cur_collection_start_sec() * 1000.0;
 
-  while (!evacuation_failed() && collection_set()->optional_region_length() > 0) {
+  while (!evacuation_alloc_failed() && collection_set()->optional_region_length() > 0) {
 
     double time_used_ms = os::elapsedTime() * 1000.0 - collection_start_time_ms;
     double time_left_ms = MaxGCPauseMillis - time_used_ms;
@@ -1013,6 +1024,14 @@ bool G1YoungCollector::evacuation_failed() const {
   return _evac_failure_regions.evacuation_failed();
 }
 
+bool G1YoungCollector::evacuation_alloc_failed() const {
+  return _evac_failure_regions.has_regions_alloc_failed();
+}
+
+bool G1YoungCollector::evacuation_pinned() const {
+  return _evac_failure_regions.has_regions_evac_pinned();
+}
+
 G1YoungCollector::G1YoungCollector(GCCause::Cause gc_cause) :
   _g1h(G1CollectedHeap::heap()),
   _gc_cause(gc_cause),
@@ -1075,6 +1094,10 @@ void G1YoungCollector::collect() {
     }
     post_evacuate_collection_set(jtm.evacuation_info(), &per_thread_states);
 
+    if (_g1h->klass_survival_table() != nullptr) {
+      _g1h->klass_survival_table()->update();
+    }
+
     // Refine the type of a concurrent mark operation now that we did the
     // evacuation, eventually aborting it.
     _concurrent_operation_is_full_mark = policy()->concurrent_operation_is_full_mark("Revise IHOP");
@@ -1083,7 +1106,7 @@ void G1YoungCollector::collect() {
     // modifies it to the next state.
     jtm.report_pause_type(collector_state()->young_gc_pause_type(_concurrent_operation_is_full_mark));
 
-    policy()->record_young_collection_end(_concurrent_operation_is_full_mark, evacuation_failed());
+    policy()->record_young_collection_end(_concurrent_operation_is_full_mark, evacuation_alloc_failed());
   }
   TASKQUEUE_STATS_ONLY(_g1h->task_queues()->print_and_reset_taskqueue_stats("Oop Queue");)
 }
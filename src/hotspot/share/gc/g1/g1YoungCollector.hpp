@@ -133,6 +133,11 @@ class G1YoungCollector {
 
   // True iff an evacuation has failed in the most-recent collection.
   bool evacuation_failed() const;
+  // True iff an evacuation has failed because of an allocation failure (and not
+  // only because of pinned regions) in the most-recent collection.
+  bool evacuation_alloc_failed() const;
+  // True iff some region could not be evacuated because it has pinned objects.
+  bool evacuation_pinned() const;
 
 public:
   G1YoungCollector(GCCause::Cause gc_cause);
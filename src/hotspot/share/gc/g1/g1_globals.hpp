@@ -117,6 +117,11 @@
           "Confidence level for MMU/pause predictions")                     \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, G1UseAllocationRateForecast, false, EXPERIMENTAL,          \
+          "Size the young generation for the allocation rate extrapolated " \
+          "from its recent trend, not only for the average allocation "     \
+          "rate, so that eden grows ahead of an allocation burst.")         \
+                                                                            \
   product(intx, G1SummarizeRSetStatsPeriod, 0, DIAGNOSTIC,                  \
           "The period (in number of GCs) at which we will generate "        \
           "update buffer processing info "                                  \
@@ -135,6 +140,25 @@
           "draining concurrent marking work queues.")                       \
           range(1, INT_MAX)                                                 \
                                                                             \
+  product(uint, G1EvacuationPrefetchDistance, 0, EXPERIMENTAL,              \
+          "Number of tasks popped ahead from the local task queue during "  \
+          "evacuation whose referents are prefetched before the task is "   \
+          "processed. A value of zero disables prefetching.")               \
+          range(0, 16)                                                      \
+                                                                            \
+  product(bool, G1EarlyPromotion, false, EXPERIMENTAL,                      \
+          "Promote objects of classes whose instances mostly survive "      \
+          "their second young collection at that collection, instead of "   \
+          "copying them between survivor regions until they reach the "     \
+          "tenuring threshold.")                                            \
+                                                                            \
+  product(uint, G1EarlyPromotionSurvivalPercent, 90, EXPERIMENTAL,          \
+          "Minimum percentage of the sampled objects of a class surviving " \
+          "their first young collection that must also survive the next "   \
+          "one for G1EarlyPromotion to promote objects of that class "      \
+          "early.")                                                         \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, G1UseReferencePrecleaning, true, EXPERIMENTAL,              \
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
@@ -303,6 +327,25 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(double, G1PeriodicGCMemoryPressureThreshold, 0.0, MANAGEABLE,     \
+          "Container memory pressure in percent, as the 10s average of "    \
+          "the cgroup v2 memory.pressure file, at which G1 considers the "  \
+          "container to be under memory pressure. Memory usage above "      \
+          "memory.high counts as memory pressure too. Under memory "        \
+          "pressure G1 triggers a periodic GC independent of "              \
+          "G1PeriodicGCInterval, shrinks the heap down to "                 \
+          "MinHeapFreeRatio and does not expand it after young "            \
+          "collections. A value of zero disables this check. Only "         \
+          "supported on Linux.")                                            \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  product(uintx, G1PeriodicGCIdleInterval, 0, EXPERIMENTAL,                 \
+          "Number of milliseconds without Java heap allocation after "      \
+          "which G1 triggers a periodic GC independent of "                 \
+          "G1PeriodicGCInterval, once per idle period. Allocation is "      \
+          "sampled every second. G1PeriodicGCSystemLoadThreshold still "    \
+          "applies. A value of zero disables this check.")                  \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
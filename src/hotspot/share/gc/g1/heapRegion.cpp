@@ -229,6 +229,7 @@ HeapRegion::HeapRegion(uint hrm_index,
   _top_at_mark_start(nullptr),
   _parsable_bottom(nullptr),
   _garbage_bytes(0),
+  _pinned_object_count(0),
   _young_index_in_cset(-1),
   _surv_rate_group(nullptr),
   _age_index(G1SurvRateGroup::InvalidAgeIndex),
@@ -415,6 +416,9 @@ void HeapRegion::print_on(outputStream* st) const {
   }
   st->print("|TAMS " PTR_FORMAT "| PB " PTR_FORMAT "| %s ",
             p2i(top_at_mark_start()), p2i(parsable_bottom_acquire()), rem_set()->get_state_str());
+  if (has_pinned_objects()) {
+    st->print("|P %zu", pinned_count());
+  }
   if (UseNUMA) {
     G1NUMA* numa = G1NUMA::numa();
     if (node_index() < numa->num_active_nodes()) {
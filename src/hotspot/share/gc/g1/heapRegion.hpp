@@ -33,6 +33,7 @@
 #include "gc/shared/ageTable.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/verifyOption.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "utilities/macros.hpp"
 
@@ -239,6 +240,10 @@ class HeapRegion : public CHeapObj<mtGC> {
   // Amount of dead data in the region.
   size_t _garbage_bytes;
 
+  // Number of objects in this region that are currently pinned, e.g. by JNI
+  // critical sections. Regions with pinned objects are never evacuated.
+  volatile size_t _pinned_object_count;
+
   inline void init_top_at_mark_start();
 
   // Data for young region survivor prediction.
@@ -326,6 +331,11 @@ class HeapRegion : public CHeapObj<mtGC> {
   // A lower bound on the amount of garbage bytes in the region.
   size_t garbage_bytes() const { return _garbage_bytes; }
 
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+  size_t pinned_count() const { return Atomic::load(&_pinned_object_count); }
+  bool has_pinned_objects() const { return pinned_count() > 0; }
+
   // Return the amount of bytes we'll reclaim if we collect this
   // region. This includes not only the known garbage bytes in the
   // region but also any unallocated space in it, i.e., [top, end),
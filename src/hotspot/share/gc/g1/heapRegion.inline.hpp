@@ -303,6 +303,15 @@ inline void HeapRegion::note_end_of_scrubbing() {
   reset_parsable_bottom();
 }
 
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::add(&_pinned_object_count, (size_t)1, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "region %u must have pinned objects", hrm_index());
+  Atomic::sub(&_pinned_object_count, (size_t)1, memory_order_relaxed);
+}
+
 inline void HeapRegion::init_top_at_mark_start() {
   reset_top_at_mark_start();
   _parsable_bottom = bottom();
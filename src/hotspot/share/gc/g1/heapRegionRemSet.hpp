@@ -114,6 +114,14 @@ class HeapRegionRemSet : public CHeapObj<mtGC> {
 
   inline void add_reference(OopOrNarrowOopStar from, uint tid);
 
+  // Filters the reference through the from card cache. Returns whether the
+  // card of from must still be added to this remembered set.
+  inline bool should_add_reference(OopOrNarrowOopStar from, uint tid);
+  // Adds the given cards, see G1CardSet::add_cards().
+  void add_cards(const uintptr_t* cards, size_t num_cards) {
+    _card_set.add_cards(cards, num_cards);
+  }
+
   // The region is being reclaimed; clear its remset, and any mention of
   // entries for this region in other remsets.
   void clear(bool only_cardset = false, bool keep_tracked = false);
@@ -134,6 +142,10 @@ class HeapRegionRemSet : public CHeapObj<mtGC> {
     return _card_set.unused_mem_size();
   }
 
+  size_t small_array_saved_mem_size() const {
+    return _card_set.small_array_saved_mem_size();
+  }
+
   // Returns the memory occupancy of all static data structures associated
   // with remembered sets.
   static size_t static_mem_size() {
@@ -120,20 +120,21 @@ uintptr_t HeapRegionRemSet::to_card(OopOrNarrowOopStar from) const {
   return pointer_delta(from, _heap_base_address, 1) >> CardTable::card_shift();
 }
 
-void HeapRegionRemSet::add_reference(OopOrNarrowOopStar from, uint tid) {
+bool HeapRegionRemSet::should_add_reference(OopOrNarrowOopStar from, uint tid) {
   assert(_state != Untracked, "must be");
 
   uint cur_idx = _hr->hrm_index();
   uintptr_t from_card = uintptr_t(from) >> CardTable::card_shift();
 
-  if (G1FromCardCache::contains_or_replace(tid, cur_idx, from_card)) {
-    // We can't check whether the card is in the remembered set - the card container
-    // may be coarsened just now.
-    //assert(contains_reference(from), "We just found " PTR_FORMAT " in the FromCardCache", p2i(from));
-   return;
-  }
+  // We can't check whether the card is in the remembered set if it is in the
+  // FromCardCache - the card container may be coarsened just now.
+  return !G1FromCardCache::contains_or_replace(tid, cur_idx, from_card);
+}
 
-  _card_set.add_card(to_card(from));
+void HeapRegionRemSet::add_reference(OopOrNarrowOopStar from, uint tid) {
+  if (should_add_reference(from, tid)) {
+    _card_set.add_card(to_card(from));
+  }
 }
 
 bool HeapRegionRemSet::contains_reference(OopOrNarrowOopStar from) {
@@ -686,6 +686,162 @@ ParallelCompactData::summarize_split_space(size_t src_region,
   return source_next;
 }
 
+void ParallelCompactData::summarize_region(const SplitInfo& split_info,
+                                           size_t cur_region,
+                                           HeapWord* dest_addr)
+{
+  // The destination must be set even if the region has no data.
+  _region_data[cur_region].set_destination(dest_addr);
+
+  size_t words = _region_data[cur_region].data_size();
+  if (words == 0) {
+    return;
+  }
+
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
+size_t ParallelCompactData::live_words_in_regions(size_t beg_region,
+                                                  size_t end_region) const
+{
+  size_t words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    words += _region_data[cur_region].data_size();
+  }
+  return words;
+}
+
+HeapWord* ParallelCompactData::summarize_regions(const SplitInfo& split_info,
+                                                 size_t beg_region,
+                                                 size_t end_region,
+                                                 HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    summarize_region(split_info, cur_region, dest_addr);
+    dest_addr += _region_data[cur_region].data_size();
+  }
+  return dest_addr;
+}
+
+// Summarizes a range of regions known to fit into the target with the help of
+// the GC workers.  The range is cut into fixed-size chunks; the workers first
+// sum the live words of each chunk, the chunk sums are turned into the
+// destination of the first region of every chunk, and the workers then
+// summarize the chunks independently.  Every destination region gets its
+// source_region from the single source region that supplies its first word,
+// so no two chunks write the same field.
+class PSSummarizeTask final : public WorkerTask {
+public:
+  static const size_t RegionsPerChunk = 256;
+
+private:
+  ParallelCompactData& _sd;
+  const SplitInfo&     _split_info;
+  const size_t         _beg_region;
+  const size_t         _end_region;
+  const size_t         _num_chunks;
+  HeapWord**           _chunk_dest;
+  size_t*              _chunk_words;
+  bool                 _summarize;
+  volatile size_t      _claimed;
+
+  size_t chunk_beg(size_t chunk) const {
+    return _beg_region + chunk * RegionsPerChunk;
+  }
+  size_t chunk_end(size_t chunk) const {
+    return MIN2(chunk_beg(chunk) + RegionsPerChunk, _end_region);
+  }
+
+public:
+  PSSummarizeTask(ParallelCompactData& sd, const SplitInfo& split_info,
+                  size_t beg_region, size_t end_region) :
+    WorkerTask("PSSummarize task"),
+    _sd(sd),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _num_chunks(align_up(end_region - beg_region, RegionsPerChunk) / RegionsPerChunk),
+    _chunk_dest(NEW_C_HEAP_ARRAY(HeapWord*, _num_chunks, mtGC)),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_chunks, mtGC)),
+    _summarize(false),
+    _claimed(0) {}
+
+  ~PSSummarizeTask() {
+    FREE_C_HEAP_ARRAY(HeapWord*, _chunk_dest);
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+  }
+
+  // Turn the per-chunk live sizes into chunk destinations and switch the
+  // task to summarizing.  Returns the destination following the last region.
+  HeapWord* compute_chunk_destinations(HeapWord* dest_addr) {
+    for (size_t chunk = 0; chunk < _num_chunks; ++chunk) {
+      _chunk_dest[chunk] = dest_addr;
+      dest_addr += _chunk_words[chunk];
+    }
+    _summarize = true;
+    _claimed = 0;
+    return dest_addr;
+  }
+
+  void work(uint worker_id) {
+    for (size_t chunk = Atomic::fetch_then_add(&_claimed, size_t(1));
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_then_add(&_claimed, size_t(1))) {
+      if (_summarize) {
+        HeapWord* const end = _sd.summarize_regions(_split_info, chunk_beg(chunk),
+                                                    chunk_end(chunk), _chunk_dest[chunk]);
+        assert(end == _chunk_dest[chunk] + _chunk_words[chunk], "must match");
+      } else {
+        _chunk_words[chunk] = _sd.live_words_in_regions(chunk_beg(chunk), chunk_end(chunk));
+      }
+    }
+  }
+};
+
 bool ParallelCompactData::summarize(SplitInfo& split_info,
                                     HeapWord* source_beg, HeapWord* source_end,
                                     HeapWord** source_next,
@@ -702,71 +858,41 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   size_t cur_region = addr_to_region_idx(source_beg);
   const size_t end_region = addr_to_region_idx(region_align_up(source_end));
 
+  if (source_next == nullptr) {
+    // The caller guarantees that everything fits, so no region can split and
+    // the destinations are a plain prefix sum over the live sizes.
+    WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+    HeapWord* dest_addr;
+    if (workers.active_workers() > 1 &&
+        end_region - cur_region >= 2 * PSSummarizeTask::RegionsPerChunk) {
+      PSSummarizeTask task(*this, split_info, cur_region, end_region);
+      workers.run_task(&task);
+      dest_addr = task.compute_chunk_destinations(target_beg);
+      assert(dest_addr <= target_end, "summarized data must fit");
+      workers.run_task(&task);
+    } else {
+      dest_addr = summarize_regions(split_info, cur_region, end_region, target_beg);
+      assert(dest_addr <= target_end, "summarized data must fit");
+    }
+    *target_next = dest_addr;
+    return true;
+  }
+
   HeapWord *dest_addr = target_beg;
   while (cur_region < end_region) {
-    // The destination must be set even if the region has no data.
-    _region_data[cur_region].set_destination(dest_addr);
-
     size_t words = _region_data[cur_region].data_size();
-    if (words > 0) {
-      // If cur_region does not fit entirely into the target space, find a point
-      // at which the source space can be 'split' so that part is copied to the
-      // target space and the rest is copied elsewhere.
-      if (dest_addr + words > target_end) {
-        assert(source_next != nullptr, "source_next is null when splitting");
-        *source_next = summarize_split_space(cur_region, split_info, dest_addr,
-                                             target_end, target_next);
-        return false;
-      }
-
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
-      dest_addr += words;
+    // If cur_region does not fit entirely into the target space, find a point
+    // at which the source space can be 'split' so that part is copied to the
+    // target space and the rest is copied elsewhere.
+    if (words > 0 && dest_addr + words > target_end) {
+      _region_data[cur_region].set_destination(dest_addr);
+      *source_next = summarize_split_space(cur_region, split_info, dest_addr,
+                                           target_end, target_next);
+      return false;
     }
 
+    summarize_region(split_info, cur_region, dest_addr);
+    dest_addr += words;
     ++cur_region;
   }
 
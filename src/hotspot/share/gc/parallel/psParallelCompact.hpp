@@ -425,6 +425,8 @@ class ParallelCompactData
   // beg and end must be region-aligned.
   void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
 
+  void summarize_region(const SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr);
   HeapWord* summarize_split_space(size_t src_region, SplitInfo& split_info,
                                   HeapWord* destination, HeapWord* target_end,
                                   HeapWord** target_next);
@@ -434,6 +436,14 @@ class ParallelCompactData
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Summarize the regions [beg_region, end_region), which must all fit into
+  // the target starting at dest_addr, and return the address following the
+  // last live word.  Used by the serial and the parallel summarization.
+  HeapWord* summarize_regions(const SplitInfo& split_info,
+                              size_t beg_region, size_t end_region,
+                              HeapWord* dest_addr);
+  size_t live_words_in_regions(size_t beg_region, size_t end_region) const;
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
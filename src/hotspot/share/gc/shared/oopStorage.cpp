@@ -112,6 +112,19 @@ void OopStorage::AllocationList::unlink(const Block& block) {
   }
 }
 
+void OopStorage::AllocationList::insert_after(const Block& prev, const Block& block) {
+  const Block* next_blk = prev.allocation_list_entry()._next;
+  block.allocation_list_entry()._prev = &prev;
+  block.allocation_list_entry()._next = next_blk;
+  prev.allocation_list_entry()._next = &block;
+  if (next_blk == nullptr) {
+    assert(_tail == &prev, "invariant");
+    _tail = &block;
+  } else {
+    next_blk->allocation_list_entry()._prev = &block;
+  }
+}
+
 bool OopStorage::AllocationList::contains(const Block& block) const {
   return (next(block) != nullptr) || (ctail() == &block);
 }
@@ -253,6 +266,13 @@ size_t OopStorage::Block::allocation_alignment_shift() {
 static inline bool is_full_bitmask(uintx bitmask) { return ~bitmask == 0; }
 static inline bool is_empty_bitmask(uintx bitmask) { return bitmask == 0; }
 
+// A block is sparse if only a few of its entries are in use.  Such blocks
+// are placed behind the denser blocks in the _allocation_list, so they can
+// drain and eventually be deleted instead of being walked by every GC.
+static inline bool is_sparse_bitmask(uintx bitmask) {
+  return !is_empty_bitmask(bitmask) && population_count(bitmask) <= BitsPerWord / 8;
+}
+
 bool OopStorage::Block::is_full() const {
   return is_full_bitmask(allocated_bitmask());
 }
@@ -431,7 +451,9 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // list state consistent with its current _allocated_bitmask.  The block is
 // added to the _allocation_list if not already present and the bitmask is not
 // full.  The block is moved to the end of the _allocation_list if the bitmask
-// is empty, for ease of empty block deletion processing.
+// is empty, for ease of empty block deletion processing.  A block whose
+// release makes it sparse is also recorded as a deferred update, and is moved
+// behind the other non-empty blocks, so allocation prefers denser blocks.
 
 oop* OopStorage::allocate() {
   MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
@@ -660,6 +682,9 @@ static void log_release_transitions(uintx releasing,
     }
     if (releasing == old_allocated) {
       ls.print_cr("%s: block empty " PTR_FORMAT, owner->name(), p2i(block));
+    } else if (!is_sparse_bitmask(old_allocated) &&
+               is_sparse_bitmask(old_allocated ^ releasing)) {
+      ls.print_cr("%s: block sparse " PTR_FORMAT, owner->name(), p2i(block));
     }
   }
 }
@@ -680,12 +705,13 @@ void OopStorage::Block::release_entries(uintx releasing, OopStorage* owner) {
   }
 
   // Now that the bitmask has been updated, if we have a state transition
-  // (updated bitmask is empty or old bitmask was full), atomically push
-  // this block onto the deferred updates list.  Some future call to
+  // (updated bitmask is empty or sparse, or old bitmask was full), atomically
+  // push this block onto the deferred updates list.  Some future call to
   // reduce_deferred_updates will make any needed changes related to this
   // block and _allocation_list.  This deferral avoids _allocation_list
   // updates and the associated locking here.
-  if ((releasing == old_allocated) || is_full_bitmask(old_allocated)) {
+  if ((releasing == old_allocated) || is_full_bitmask(old_allocated) ||
+      (!is_sparse_bitmask(old_allocated) && is_sparse_bitmask(old_allocated ^ releasing))) {
     // Log transitions.  Both transitions are possible in a single update.
     log_release_transitions(releasing, old_allocated, owner, this);
     // Attempt to claim responsibility for adding this block to the deferred
@@ -702,8 +728,8 @@ void OopStorage::Block::release_entries(uintx releasing, OopStorage* owner) {
         if (fetched == head) break; // Successful update.
         head = fetched;             // Retry with updated head.
       }
-      // Only request cleanup for to-empty transitions, not for from-full.
-      // There isn't any rush to process from-full transitions.  Allocation
+      // Only request cleanup for to-empty transitions, not for from-full or
+      // to-sparse.  There isn't any rush to process those transitions.  Allocation
       // will reduce deferrals before allocating new blocks, so may process
       // some.  And the service thread will drain the entire deferred list
       // if there are any pending to-empty transitions.
@@ -747,13 +773,20 @@ bool OopStorage::reduce_deferred_updates() {
     assert(!_allocation_list.contains(*block), "invariant");
   } else if (_allocation_list.contains(*block)) {
     // Block is in list.  If empty, move to the end for possible deletion.
+    // If sparse, move behind the other non-empty blocks.
     if (is_empty_bitmask(allocated)) {
       _allocation_list.unlink(*block);
       _allocation_list.push_back(*block);
+    } else if (is_sparse_bitmask(allocated)) {
+      _allocation_list.unlink(*block);
+      push_sparse_block(*block);
     }
   } else if (is_empty_bitmask(allocated)) {
     // Block is empty and not in list. Add to back for possible deletion.
     _allocation_list.push_back(*block);
+  } else if (is_sparse_bitmask(allocated)) {
+    // Block is sparse and not in list.  Add behind the other non-empty blocks.
+    push_sparse_block(*block);
   } else {
     // Block is neither full nor empty, and not in list.  Add to front.
     _allocation_list.push_front(*block);
@@ -764,6 +797,21 @@ bool OopStorage::reduce_deferred_updates() {
   return true;              // Processed one pending update.
 }
 
+// Add a sparse block to the _allocation_list, after all other non-empty blocks
+// but ahead of the empty blocks kept at the end of the list for deletion.
+void OopStorage::push_sparse_block(const Block& block) {
+  assert_lock_strong(_allocation_mutex);
+  const Block* prev = _allocation_list.ctail();
+  while ((prev != nullptr) && prev->is_empty()) {
+    prev = _allocation_list.prev(*prev);
+  }
+  if (prev == nullptr) {
+    _allocation_list.push_front(block);
+  } else {
+    _allocation_list.insert_after(*prev, block);
+  }
+}
+
 static inline void check_release_entry(const oop* entry) {
   assert(entry != nullptr, "Releasing null");
   assert(Universe::heap()->contains_null(entry), "Releasing uncleared entry: " PTR_FORMAT, p2i(entry));
@@ -250,6 +250,7 @@ class OopStorage : public CHeapObjBase {
 
     void push_front(const Block& block);
     void push_back(const Block& block);
+    void insert_after(const Block& prev, const Block& block);
     void unlink(const Block& block);
 
     bool contains(const Block& block) const;
@@ -290,6 +291,7 @@ class OopStorage : public CHeapObjBase {
   Block* find_block_or_null(const oop* ptr) const;
   void delete_empty_block(const Block& block);
   bool reduce_deferred_updates();
+  void push_sparse_block(const Block& block);
   void record_needs_cleanup();
 
   // Managing _active_array.
@@ -40,6 +40,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -103,7 +104,12 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 
 void StringDedup::Processor::yield() const {
   assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  // Only transition when a safepoint or handshake is pending.  Blocking for
+  // every request costs a thread state transition per string, which limits
+  // how many requests the single processor thread can get through.
+  if (SafepointMechanism::should_process(_thread)) {
+    ThreadBlockInVM tbivm(_thread);
+  }
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
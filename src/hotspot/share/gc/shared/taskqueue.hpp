@@ -61,6 +61,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_numa_local, // subset of successful steals from a queue on the same NUMA node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +83,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_numa_local_steal() { ++_stats[steal_numa_local]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -480,6 +482,19 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   uint _n;
   T** _queues;
 
+  // The NUMA node each queue's owner last ran on when it tried to steal, or
+  // null if victims are selected without regard to NUMA placement.
+  int* _numa_ids;
+
+  static const int UnknownNumaId = -1;
+
+  void record_numa_id(uint queue_num);
+  bool is_numa_local(uint queue_num, uint victim) const;
+
+  // Picks a random queue other than queue_num and exclude, preferring a queue
+  // whose owner runs on the same NUMA node as the owner of queue_num.
+  uint random_victim(uint queue_num, uint exclude);
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
@@ -33,23 +33,32 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
 
 template <class T, MEMFLAGS F>
-inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
+inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n), _numa_ids(nullptr) {
   typedef T* GenericTaskQueuePtr;
   _queues = NEW_C_HEAP_ARRAY(GenericTaskQueuePtr, n, F);
   for (uint i = 0; i < n; i++) {
     _queues[i] = nullptr;
   }
+  if (UseNUMA && os::numa_get_groups_num() > 1 && n > 2) {
+    _numa_ids = NEW_C_HEAP_ARRAY(int, n, F);
+    for (uint i = 0; i < n; i++) {
+      _numa_ids[i] = UnknownNumaId;
+    }
+  }
 }
 
 template <class T, MEMFLAGS F>
 inline GenericTaskQueueSet<T, F>::~GenericTaskQueueSet() {
   FREE_C_HEAP_ARRAY(T*, _queues);
+  FREE_C_HEAP_ARRAY(int, _numa_ids);
 }
 
 #if TASKQUEUE_STATS
@@ -316,6 +325,42 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class T, MEMFLAGS F>
+void GenericTaskQueueSet<T, F>::record_numa_id(uint queue_num) {
+  if (_numa_ids != nullptr) {
+    // Workers are not bound to nodes, so refresh the node of the thief
+    // every time it starts stealing.
+    Atomic::store(&_numa_ids[queue_num], os::numa_get_group_id());
+  }
+}
+
+template<class T, MEMFLAGS F>
+bool GenericTaskQueueSet<T, F>::is_numa_local(uint queue_num, uint victim) const {
+  if (_numa_ids == nullptr) {
+    return false;
+  }
+  int victim_id = Atomic::load(&_numa_ids[victim]);
+  return victim_id != UnknownNumaId && victim_id == Atomic::load(&_numa_ids[queue_num]);
+}
+
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::random_victim(uint queue_num, uint exclude) {
+  T* const local_queue = queue(queue_num);
+  // Number of random picks spent looking for a queue on the local node
+  // before settling for a remote one.
+  const uint max_numa_picks = 4;
+  uint k = queue_num;
+  for (uint picks = 0; ; picks++) {
+    k = local_queue->next_random_queue_id() % _n;
+    if (k == queue_num || k == exclude) {
+      continue;
+    }
+    if (picks >= max_numa_picks || _numa_ids == nullptr || is_numa_local(queue_num, k)) {
+      return k;
+    }
+  }
+}
+
 template<class T, MEMFLAGS F>
 typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   T* const local_queue = queue(queue_num);
@@ -326,15 +371,10 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
       k1 = local_queue->last_stolen_queue_id();
       assert(k1 != queue_num, "Should not be the same");
     } else {
-      while (k1 == queue_num) {
-        k1 = local_queue->next_random_queue_id() % _n;
-      }
+      k1 = random_victim(queue_num, queue_num);
     }
 
-    uint k2 = queue_num;
-    while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
-    }
+    uint k2 = random_victim(queue_num, k1);
     // Sample both and try the larger.
     uint sz1 = queue(k1)->size();
     uint sz2 = queue(k2)->size();
@@ -353,6 +393,11 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
     }
 
     if (suc == PopResult::Success) {
+      TASKQUEUE_STATS_ONLY(
+        if (is_numa_local(queue_num, sel_k)) {
+          local_queue->stats.record_numa_local_steal();
+        }
+      )
       local_queue->set_last_stolen_queue_id(sel_k);
     } else {
       local_queue->invalidate_last_stolen_queue_id();
@@ -376,6 +421,7 @@ template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  record_numa_id(queue_num);
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
@@ -27,6 +27,8 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -56,6 +58,7 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
+  _idle_gcs(0),
   _allocation_fraction(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
@@ -84,8 +87,10 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   _allocated_before_last_gc = total_allocated;
 
   print_stats("gc");
+  send_statistics_event();
 
   if (_number_of_refills > 0) {
+    _idle_gcs = 0;
     // Update allocation history if a reasonable amount of eden was allocated.
     bool update_allocation_history = used > 0.5 * capacity;
 
@@ -109,6 +114,9 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    if (_idle_gcs < UINT_MAX) {
+      _idle_gcs++;
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -161,6 +169,12 @@ void ThreadLocalAllocBuffer::resize() {
 
   new_size = clamp(new_size, min_size(), max_size());
 
+  // A thread that did not refill for a number of GCs only ties up eden with
+  // its TLAB; give it the smallest one until it starts allocating again.
+  if (TLABAdaptiveThreadSizing && _idle_gcs >= TLABIdleThreadGCs) {
+    new_size = min_size();
+  }
+
   size_t aligned_new_size = align_object_size(new_size);
 
   log_trace(gc, tlab)("TLAB new size: thread: " PTR_FORMAT " [id: %2d]"
@@ -186,6 +200,9 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+  if (TLABAdaptiveThreadSizing) {
+    grow_for_refill_rate();
+  }
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
@@ -194,6 +211,23 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+void ThreadLocalAllocBuffer::grow_for_refill_rate() {
+  // Every _target_refills refills within one GC cycle the thread has used up
+  // the budget that resize() planned for the whole cycle, so do not wait for
+  // the next GC to learn about it.
+  if (!ResizeTLAB || _number_of_refills % _target_refills != 0) {
+    return;
+  }
+  size_t new_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+  if (new_size > desired_size()) {
+    log_trace(gc, tlab)("TLAB grow: thread: " PTR_FORMAT " [id: %2d]"
+                        " refills %d desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                        p2i(thread()), thread()->osthread()->thread_id(),
+                        _number_of_refills, desired_size(), new_size);
+    set_desired_size(new_size);
+  }
+}
+
 void ThreadLocalAllocBuffer::initialize(HeapWord* start,
                                         HeapWord* top,
                                         HeapWord* end) {
@@ -288,6 +322,21 @@ size_t ThreadLocalAllocBuffer::initial_desired_size() {
   return init_sz;
 }
 
+void ThreadLocalAllocBuffer::send_statistics_event() {
+  EventThreadTLABStatistics e;
+  if (e.should_commit()) {
+    e.set_thread(JFR_JVM_THREAD_ID(thread()));
+    e.set_desiredSize(desired_size() * HeapWordSize);
+    e.set_refills(_number_of_refills);
+    e.set_allocated(_allocated_size * HeapWordSize);
+    e.set_slowAllocations(_slow_allocations);
+    e.set_gcWaste(_gc_waste * HeapWordSize);
+    e.set_refillWaste(_refill_waste * HeapWordSize);
+    e.set_idleCollections(_idle_gcs);
+    e.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::print_stats(const char* tag) {
   Log(gc, tlab) log;
   if (!log.is_trace()) {
@@ -67,6 +67,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
   size_t    _allocated_size;
+  unsigned  _idle_gcs;                           // consecutive GCs without a refill
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
@@ -96,6 +97,11 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
   void print_stats(const char* tag);
+  void send_statistics_event();
+
+  // Grow the desired size of a thread that refills more often than
+  // expected between two GCs.
+  void grow_for_refill_rate();
 
   Thread* thread();
 
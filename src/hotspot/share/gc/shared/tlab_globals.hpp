@@ -88,6 +88,16 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABAdaptiveThreadSizing, false, EXPERIMENTAL,             \
+          "Shrink the TLABs of threads that stay idle across GCs to the "   \
+          "minimum size and grow the TLABs of threads that refill more "    \
+          "often than expected between GCs")                                \
+                                                                            \
+  product(uintx, TLABIdleThreadGCs, 2, EXPERIMENTAL,                        \
+          "Number of consecutive GCs without a TLAB refill after which "    \
+          "a thread is considered idle by TLABAdaptiveThreadSizing")        \
+          range(1, max_juint)                                               \
+                                                                            \
 
 // end of TLAB_FLAGS
 
@@ -185,12 +185,14 @@ void WorkerThreads::run_task(WorkerTask* task, uint num_workers) {
 THREAD_LOCAL uint WorkerThread::_worker_id = UINT_MAX;
 
 WorkerThread::WorkerThread(const char* name_prefix, uint name_suffix, WorkerTaskDispatcher* dispatcher) :
-    _dispatcher(dispatcher) {
+    _dispatcher(dispatcher),
+    _which(name_suffix) {
   set_name("%s#%u", name_prefix, name_suffix);
 }
 
 void WorkerThread::run() {
   os::set_priority(this, NearMaxPriority);
+  os::numa_place_current_thread(_which);
 
   while (true) {
     _dispatcher->worker_run_task();
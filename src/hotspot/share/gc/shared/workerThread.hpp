@@ -128,6 +128,7 @@ class WorkerThread : public NamedThread {
   static THREAD_LOCAL uint _worker_id;
 
   WorkerTaskDispatcher* const _dispatcher;
+  const uint _which;
 
   static void set_worker_id(uint worker_id) { _worker_id = worker_id; }
 
@@ -65,8 +65,10 @@ class ZStackList {
 
   bool is_empty() const;
 
-  void push(T* stack);
-  T* pop();
+  // The optional nretries is incremented for every failed attempt to
+  // update the list head, i.e. for every time the list was contended.
+  void push(T* stack, uint64_t* nretries = nullptr);
+  T* pop(uint64_t* nretries = nullptr);
 
   void clear();
 };
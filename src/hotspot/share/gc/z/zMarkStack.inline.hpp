@@ -117,7 +117,7 @@ inline bool ZStackList<T>::is_empty() const {
 }
 
 template <typename T>
-inline void ZStackList<T>::push(T* stack) {
+inline void ZStackList<T>::push(T* stack, uint64_t* nretries) {
   T* vstack = _head;
   uint32_t version = 0;
 
@@ -131,12 +131,15 @@ inline void ZStackList<T>::push(T* stack) {
     }
 
     // Retry
+    if (nretries != nullptr) {
+      (*nretries)++;
+    }
     vstack = prev_vstack;
   }
 }
 
 template <typename T>
-inline T* ZStackList<T>::pop() {
+inline T* ZStackList<T>::pop(uint64_t* nretries) {
   T* vstack = _head;
   T* stack = nullptr;
   uint32_t version = 0;
@@ -155,6 +158,9 @@ inline T* ZStackList<T>::pop() {
     }
 
     // Retry
+    if (nretries != nullptr) {
+      (*nretries)++;
+    }
     vstack = prev_vstack;
   }
 }
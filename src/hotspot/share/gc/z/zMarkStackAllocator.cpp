@@ -27,11 +27,15 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
+#include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 
+static const ZStatCounter ZCounterMarkStackFreeListContention("Contention", "Mark Stack Free List Contention", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkStackSpaceContention("Contention", "Mark Stack Space Contention", ZStatUnitOpsPerSecond);
+
 ZMarkStackSpace::ZMarkStackSpace()
   : _expand_lock(),
     _start(0),
@@ -128,6 +132,7 @@ uintptr_t ZMarkStackSpace::alloc_space(size_t size) {
     }
 
     // Retry
+    ZStatInc(ZCounterMarkStackSpaceContention);
     top = prev_top;
   }
 }
@@ -201,7 +206,11 @@ ZMarkStackMagazine* ZMarkStackAllocator::create_magazine_from_space(uintptr_t ad
 
 ZMarkStackMagazine* ZMarkStackAllocator::alloc_magazine() {
   // Try allocating from the free list first
-  ZMarkStackMagazine* const magazine = _freelist.pop();
+  uint64_t nretries = 0;
+  ZMarkStackMagazine* const magazine = _freelist.pop(&nretries);
+  if (nretries > 0) {
+    ZStatInc(ZCounterMarkStackFreeListContention, nretries);
+  }
   if (magazine != nullptr) {
     return magazine;
   }
@@ -228,7 +237,11 @@ bool ZMarkStackAllocator::clear_and_get_expanded_recently() {
 }
 
 void ZMarkStackAllocator::free_magazine(ZMarkStackMagazine* magazine) {
-  _freelist.push(magazine);
+  uint64_t nretries = 0;
+  _freelist.push(magazine, &nretries);
+  if (nretries > 0) {
+    ZStatInc(ZCounterMarkStackFreeListContention, nretries);
+  }
 }
 
 void ZMarkStackAllocator::free() {
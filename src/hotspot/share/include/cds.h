@@ -39,7 +39,7 @@
 #define CDS_ARCHIVE_MAGIC 0xf00baba2
 #define CDS_DYNAMIC_ARCHIVE_MAGIC 0xf00baba8
 #define CDS_GENERIC_HEADER_SUPPORTED_MIN_VERSION 13
-#define CURRENT_CDS_ARCHIVE_VERSION 18
+#define CURRENT_CDS_ARCHIVE_VERSION 20
 
 typedef struct CDSFileMapRegion {
   int     _crc;               // CRC checksum of this region.
@@ -63,6 +63,8 @@ typedef struct CDSFileMapRegion {
                               //   is picked by the OS.
   size_t  _used;              // Number of bytes actually used by this region (excluding padding bytes added
                               // for alignment purposed.
+  size_t  _compressed_size;   // Number of bytes this region occupies in the archive file if it has been
+                              // compressed (see CompressArchiveRegions), or 0 if it's stored uncompressed.
   size_t  _oopmap_offset;     // Bitmap for relocating oop fields in archived heap objects.
                               // (The base address is the bottom of the BM region)
   size_t  _oopmap_size_in_bits;
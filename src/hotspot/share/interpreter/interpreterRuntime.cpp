@@ -657,22 +657,26 @@ JRT_END
 //
 
 void InterpreterRuntime::resolve_get_put(JavaThread* current, Bytecodes::Code bytecode) {
-  // resolve field
-  fieldDescriptor info;
   LastFrameAccessor last_frame(current);
   constantPoolHandle pool(current, last_frame.method()->constants());
   methodHandle m(current, last_frame.method());
+  int field_index = last_frame.get_index_u2(bytecode);
+
+  JvmtiHideSingleStepping jhss(current);
+  JavaThread* THREAD = current; // For exception macros.
+  resolve_get_put(bytecode, field_index, m, pool, THREAD);
+}
+
+void InterpreterRuntime::resolve_get_put(Bytecodes::Code bytecode, int field_index,
+                                         const methodHandle& m, const constantPoolHandle& pool, TRAPS) {
+  // resolve field
+  fieldDescriptor info;
   bool is_put    = (bytecode == Bytecodes::_putfield  || bytecode == Bytecodes::_nofast_putfield ||
                     bytecode == Bytecodes::_putstatic);
   bool is_static = (bytecode == Bytecodes::_getstatic || bytecode == Bytecodes::_putstatic);
 
-  int field_index = last_frame.get_index_u2(bytecode);
-  {
-    JvmtiHideSingleStepping jhss(current);
-    JavaThread* THREAD = current; // For exception macros.
-    LinkResolver::resolve_field_access(info, pool, field_index,
-                                       m, bytecode, CHECK);
-  } // end JvmtiHideSingleStepping
+  LinkResolver::resolve_field_access(info, pool, field_index,
+                                     m, bytecode, CHECK);
 
   // check if link resolution caused cpCache to be updated
   if (pool->resolved_field_entry_at(field_index)->is_resolved(bytecode)) return;
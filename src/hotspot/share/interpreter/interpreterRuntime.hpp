@@ -91,6 +91,10 @@ class InterpreterRuntime: AllStatic {
   static void    throw_pending_exception(JavaThread* current);
 
   static void resolve_from_cache(JavaThread* current, Bytecodes::Code bytecode);
+
+  // Used by ClassPrelinker
+  static void resolve_get_put(Bytecodes::Code bytecode, int field_index,
+                              const methodHandle& m, const constantPoolHandle& pool, TRAPS);
  private:
   // Statics & fields
   static void resolve_get_put(JavaThread* current, Bytecodes::Code bytecode);
@@ -23,6 +23,8 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/cds_globals.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/classLoaderStats.hpp"
 #include "classfile/javaClasses.hpp"
@@ -61,6 +63,7 @@
 #include "runtime/os_perf.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threads.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/classLoadingService.hpp"
@@ -573,6 +576,30 @@ TRACE_REQUEST_FUNC(ClassLoadingStatistics) {
 #endif
 }
 
+TRACE_REQUEST_FUNC(CDSPhaseStatistics) {
+#if INCLUDE_CDS
+  if (!UseSharedSpaces || !RecordCDSStatistics) {
+    return;
+  }
+  JfrTicks time_stamp = JfrTicks::now();
+  for (int i = 0; i < CDSStatistics::num_phases; i++) {
+    CDSStatistics::Phase phase = (CDSStatistics::Phase)i;
+    EventCDSPhaseStatistics event(UNTIMED);
+    event.set_phase(CDSStatistics::phase_name(phase));
+    event.set_count(CDSStatistics::count(phase));
+    event.set_totalTime((s8)(TimeHelper::counter_to_seconds(CDSStatistics::ticks(phase)) * NANOSECS_PER_SEC));
+    event.set_bytes((u8)CDSStatistics::bytes(phase));
+    event.set_minorPageFaults(CDSStatistics::minor_faults(phase));
+    event.set_majorPageFaults(CDSStatistics::major_faults(phase));
+    event.set_starttime(time_stamp);
+    event.set_endtime(time_stamp);
+    event.commit();
+  }
+#else
+  log_debug(jfr, system)("Unable to generate requestable event CDSPhaseStatistics. The required jvm feature 'cds' is missing.");
+#endif
+}
+
 class JfrClassLoaderStatsClosure : public ClassLoaderStatsClosure {
 public:
   JfrClassLoaderStatsClosure() : ClassLoaderStatsClosure(nullptr) {}
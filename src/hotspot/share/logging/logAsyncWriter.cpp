@@ -78,11 +78,16 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     bool p_created;
     uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
     *counter = *counter + 1;
+    Atomic::store(&_dropped_messages, _dropped_messages + 1);
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The AsyncLog thread only waits while no data is available, so once it
+  // has been notified further notifications just lengthen the critical section.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -103,7 +108,8 @@ void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iter
 AsyncLogWriter::AsyncLogWriter()
   : _flush_sem(0), _lock(), _data_available(false),
     _initialized(false),
-    _stats() {
+    _stats(),
+    _dropped_messages(0) {
 
   size_t size = AsyncLogBufferSize / 2;
   _buffer = new Buffer(size);
@@ -223,6 +229,10 @@ void AsyncLogWriter::flush() {
   }
 }
 
+size_t AsyncLogWriter::dropped_messages() {
+  return _instance != nullptr ? Atomic::load(&_instance->_dropped_messages) : 0;
+}
+
 AsyncLogWriter::BufferUpdater::BufferUpdater(size_t newsize) {
   AsyncLogLocker locker;
   auto p = AsyncLogWriter::_instance;
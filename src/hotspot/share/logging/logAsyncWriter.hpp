@@ -163,6 +163,8 @@ class AsyncLogWriter : public NonJavaThread {
   bool _data_available;
   volatile bool _initialized;
   AsyncLogMap<AnyObj::C_HEAP> _stats;
+  // Total number of messages dropped since startup, for VM.log reporting.
+  volatile size_t _dropped_messages;
 
   // ping-pong buffers
   Buffer* _buffer;
@@ -203,6 +205,7 @@ class AsyncLogWriter : public NonJavaThread {
   static AsyncLogWriter* instance();
   static void initialize();
   static void flush();
+  static size_t dropped_messages();
 };
 
 #endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -567,6 +567,9 @@ void LogConfiguration::describe_current_configuration(outputStream* out) {
     }
     out->cr();
   }
+  if (AsyncLogWriter::instance() != nullptr) {
+    out->print_cr("Asynchronous logging: " SIZE_FORMAT " messages dropped", AsyncLogWriter::dropped_messages());
+  }
 }
 
 void LogConfiguration::describe(outputStream* out) {
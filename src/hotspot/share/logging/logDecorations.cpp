@@ -90,15 +90,48 @@ const char* LogDecorations::decoration(LogDecorators::Decorator decorator, char*
   return buf;
 }
 
+// Formatting an ISO-8601 timestamp needs a localtime/gmtime conversion,
+// which dominates the cost of the "time" and "utctime" decorations. Messages
+// printed back to back by one thread mostly fall into the same second, so
+// each thread keeps its last formatted timestamp and, while the second does
+// not change, only rewrites the milliseconds digits.
+struct LogTimestampCache {
+  jlong _seconds;
+  bool _valid;
+  char _buf[os::iso8601_timestamp_size];
+};
+static THREAD_LOCAL LogTimestampCache _timestamp_cache[2]; // [0] local, [1] UTC
+
+static const char* cached_iso8601_time(jlong millis, bool utc) {
+  // Offset of the milliseconds in "YYYY-MM-DDThh:mm:ss.mmm+zzzz".
+  const int millis_offset = 20;
+  LogTimestampCache& cache = _timestamp_cache[utc ? 1 : 0];
+  const jlong seconds = millis / MILLIUNITS;
+  const int millis_after_second = checked_cast<int>(millis % MILLIUNITS);
+  if (millis < 0) {
+    // Not worth caching; the fixed layout assumption does not hold.
+    cache._valid = false;
+    return os::iso8601_time(millis, cache._buf, sizeof(cache._buf), utc);
+  }
+  if (cache._valid && cache._seconds == seconds) {
+    cache._buf[millis_offset]     = '0' + millis_after_second / 100;
+    cache._buf[millis_offset + 1] = '0' + (millis_after_second / 10) % 10;
+    cache._buf[millis_offset + 2] = '0' + millis_after_second % 10;
+    return cache._buf;
+  }
+  const char* result = os::iso8601_time(millis, cache._buf, sizeof(cache._buf), utc);
+  cache._seconds = seconds;
+  cache._valid = result != nullptr && cache._buf[millis_offset - 1] == '.';
+  return result;
+}
+
 void LogDecorations::print_time_decoration(outputStream* st) const {
-  char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), false);
+  const char* result = cached_iso8601_time(_millis, false);
   st->print_raw(result ? result : "");
 }
 
 void LogDecorations::print_utctime_decoration(outputStream* st) const {
-  char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), true);
+  const char* result = cached_iso8601_time(_millis, true);
   st->print_raw(result ? result : "");
 }
 
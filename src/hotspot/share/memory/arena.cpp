@@ -30,9 +30,14 @@
 #include "memory/arena.hpp"
 #include "memory/resourceArea.hpp"
 #include "nmt/memTracker.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/nonJavaThread.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
+#include "runtime/threadSMR.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
@@ -47,6 +52,12 @@ STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+//
+// In front of the pools every thread caches a single standard-sized chunk,
+// so that arenas that are repeatedly created and destroyed (or resource marks
+// that are repeatedly released) by one thread do not take ThreadCritical
+// each time. The cache slot is only accessed with atomic exchanges; the
+// ChunkPoolCleaner empties all slots periodically before pruning the pools.
 class ChunkPool {
   // Our four static pools
   static constexpr int _num_pools = 4;
@@ -86,6 +97,30 @@ class ChunkPool {
     _first = nullptr;
   }
 
+  // Returns the chunk cached by the current thread if it has the given length,
+  // otherwise null.
+  static Chunk* take_from_thread_cache(size_t length) {
+    Thread* thread = Thread::current_or_null();
+    if (thread == nullptr || Atomic::load(thread->cached_chunk_addr()) == nullptr) {
+      return nullptr;
+    }
+    Chunk* c = Atomic::xchg(thread->cached_chunk_addr(), (Chunk*)nullptr);
+    if (c != nullptr && c->length() != length) {
+      // Wrong size for this request; let the pool have it.
+      get_pool_for_size(c->length())->return_to_pool(c);
+      c = nullptr;
+    }
+    return c;
+  }
+
+  // Returns true if the chunk was stashed in the current thread's cache slot.
+  static bool return_to_thread_cache(Chunk* c) {
+    Thread* thread = Thread::current_or_null();
+    return thread != nullptr &&
+           Atomic::load(thread->cached_chunk_addr()) == nullptr &&
+           Atomic::cmpxchg(thread->cached_chunk_addr(), (Chunk*)nullptr, c) == nullptr;
+  }
+
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
   static ChunkPool* get_pool_for_size(size_t size) {
     for (int i = 0; i < _num_pools; i++) {
@@ -99,8 +134,22 @@ class ChunkPool {
 public:
   ChunkPool(size_t size) : _first(nullptr), _size(size) {}
 
+  // Move the chunk cached by the given thread, if any, back to its pool
+  static void flush_thread_cache(Thread* thread) {
+    Chunk* c = Atomic::xchg(thread->cached_chunk_addr(), (Chunk*)nullptr);
+    if (c != nullptr) {
+      get_pool_for_size(c->length())->return_to_pool(c);
+    }
+  }
+
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
+    for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+      flush_thread_cache(jt);
+    }
+    for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
+      flush_thread_cache(njti.current());
+    }
     for (int i = 0; i < _num_pools; i++) {
       _pools[i].prune();
     }
@@ -136,7 +185,10 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
   ChunkPool* pool = ChunkPool::get_pool_for_size(length);
   Chunk* chunk = nullptr;
   if (pool != nullptr) {
-    Chunk* c = pool->take_from_pool();
+    Chunk* c = take_from_thread_cache(length);
+    if (c == nullptr) {
+      c = pool->take_from_pool();
+    }
     if (c != nullptr) {
       assert(c->length() == length, "wrong length?");
       chunk = c;
@@ -161,7 +213,9 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
   // If this is a standard-sized chunk, return it to its pool; otherwise free it.
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
   if (pool != nullptr) {
-    pool->return_to_pool(c);
+    if (!return_to_thread_cache(c)) {
+      pool->return_to_pool(c);
+    }
   } else {
     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
     os::free(c);
@@ -190,6 +244,10 @@ void Arena::start_chunk_pool_cleaner_task() {
   cleaner->enroll();
 }
 
+void Arena::flush_chunk_cache(Thread* thread) {
+  ChunkPool::flush_thread_cache(thread);
+}
+
 Chunk::Chunk(size_t length) : _len(length) {
   _next = nullptr;         // Chain on the linked list
 }
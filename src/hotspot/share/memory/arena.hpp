@@ -124,6 +124,8 @@ class Arena : public CHeapObjBase {
  public:
   // Start the chunk_pool cleaner task
   static void start_chunk_pool_cleaner_task();
+  // Return the chunk cached by the given thread to the chunk pools
+  static void flush_chunk_cache(Thread* thread);
   Arena(MEMFLAGS memflag, Tag tag = Tag::tag_other);
   Arena(MEMFLAGS memflag, Tag tag, size_t init_size);
   ~Arena();
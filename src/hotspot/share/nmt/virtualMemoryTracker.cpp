@@ -221,6 +221,12 @@ bool ReservedMemoryRegion::remove_uncommitted_region(address addr, size_t sz) {
   while (head != nullptr) {
     crgn = head->data();
 
+    // The list is sorted by base address: no region at or past the end
+    // of del_rgn can overlap it, so there is nothing left to remove.
+    if (crgn->base() >= end) {
+      break;
+    }
+
     if (crgn->same_region(addr, sz)) {
       VirtualMemorySummary::record_uncommitted_memory(crgn->size(), flag());
       _committed_regions.remove_after(prev);
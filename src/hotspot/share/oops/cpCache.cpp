@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "cds/archiveBuilder.hpp"
 #include "cds/cdsConfig.hpp"
+#include "cds/classPrelinker.hpp"
 #include "cds/heapShared.hpp"
 #include "classfile/resolutionErrors.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -724,8 +725,24 @@ void ConstantPoolCache::remove_unshareable_info() {
     }
   }
   if (_resolved_field_entries != nullptr) {
+    ConstantPool* src_cp = ArchiveBuilder::current()->get_source_addr(constant_pool());
     for (int i = 0; i < _resolved_field_entries->length(); i++) {
-      resolved_field_entry_at(i)->remove_unshareable_info();
+      ResolvedFieldEntry* rfe = resolved_field_entry_at(i);
+      int cp_index = rfe->constant_pool_index();
+      bool archived = false;
+      if ((rfe->is_resolved(Bytecodes::_getfield) || rfe->is_resolved(Bytecodes::_putfield)) &&
+          ClassPrelinker::can_archive_resolved_field(src_cp, cp_index)) {
+        rfe->mark_and_relocate();
+        archived = true;
+      } else {
+        rfe->remove_unshareable_info();
+      }
+      ArchiveBuilder::alloc_stats()->record_field_cp_entry(archived);
+      if (log_is_enabled(Debug, cds, resolve)) {
+        ResourceMark rm;
+        log_debug(cds, resolve)("%s field CP entry [%3d]: %s", (archived ? "archived" : "reverted"),
+                                cp_index, constant_pool()->pool_holder()->external_name());
+      }
     }
   }
 }
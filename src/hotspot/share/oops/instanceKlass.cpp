@@ -1162,6 +1162,12 @@ void InstanceKlass::initialize_impl(TRAPS) {
     }
   }
 
+#if INCLUDE_CDS
+  if (ArchiveClassInitOrder && ClassListWriter::is_enabled()) {
+    ClassListWriter::write_class_init(this);
+  }
+#endif
+
   // Step 7
   // Next, if C is a class rather than an interface, initialize it's super class and super
   // interfaces.
@@ -1221,6 +1227,11 @@ void InstanceKlass::initialize_impl(TRAPS) {
   if (!HAS_PENDING_EXCEPTION) {
     set_initialization_state_and_notify(fully_initialized, THREAD);
     debug_only(vtable().verify(tty, true);)
+#if INCLUDE_CDS
+    if (ArchiveCompilations && is_shared()) {
+      CompilationPolicy::compile_archived_methods(this, THREAD);
+    }
+#endif
   }
   else {
     // Step 10 and 11
@@ -1606,6 +1617,13 @@ void InstanceKlass::call_class_initializer(TRAPS) {
       return;
     }
   }
+  if (is_preinitialized()) {
+    assert(is_shared(), "must be");
+    bool initialized = HeapShared::initialize_preinitialized_klass(this, CHECK);
+    if (initialized) {
+      return;
+    }
+  }
 #endif
 
   methodHandle h_method(THREAD, class_initializer());
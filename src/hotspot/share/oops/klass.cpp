@@ -118,7 +118,9 @@ bool Klass::search_secondary_supers(Klass* k) const {
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
     if (secondary_supers()->at(i) == k) {
-      ((Klass*)this)->set_secondary_super_cache(k);
+      if (UseSecondarySuperCache) {
+        ((Klass*)this)->set_secondary_super_cache(k);
+      }
       return true;
     }
   }
@@ -185,7 +185,10 @@ class Klass : public Metadata {
     _has_archived_enum_objs                = 1 << 4,
     // This class was not loaded from a classfile in the module image
     // or classpath.
-    _is_generated_shared_class             = 1 << 5
+    _is_generated_shared_class             = 1 << 5,
+    // The static fields of this class are restored from the archived heap
+    // instead of running its <clinit>.
+    _is_preinitialized                     = 1 << 6
   };
 #endif
 
@@ -366,6 +369,14 @@ class Klass : public Metadata {
     NOT_CDS(return false;)
   }
 
+  void set_is_preinitialized() {
+    CDS_ONLY(_shared_class_flags |= _is_preinitialized;)
+  }
+  bool is_preinitialized() const {
+    CDS_ONLY(return (_shared_class_flags & _is_preinitialized) != 0;)
+    NOT_CDS(return false;)
+  }
+
   bool is_shared() const                { // shadows MetaspaceObj::is_shared)()
     CDS_ONLY(return (_shared_class_flags & _is_shared_class) != 0;)
     NOT_CDS(return false;)
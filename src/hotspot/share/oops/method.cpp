@@ -410,6 +410,11 @@ void Method::remove_unshareable_info() {
 void Method::restore_unshareable_info(TRAPS) {
   assert(is_method() && is_valid_method(this), "ensure C++ vtable is restored");
   assert(!queued_for_compilation(), "method's queued_for_compilation flag should not be set");
+  if (method_counters() != nullptr) {
+    // Counters collected during the training run (see -XX:+ArchiveMethodCounters).
+    methodHandle mh(THREAD, this);
+    method_counters()->restore_unshareable_info(mh);
+  }
 }
 #endif
 
@@ -1181,7 +1186,11 @@ void Method::unlink_method() {
   NOT_PRODUCT(set_compiled_invocation_count(0);)
 
   clear_method_data();
-  clear_method_counters();
+  if (CDSConfig::is_dumping_method_counters() && method_counters() != nullptr) {
+    method_counters()->remove_unshareable_info();
+  } else {
+    clear_method_counters();
+  }
   remove_unshareable_flags();
 }
 
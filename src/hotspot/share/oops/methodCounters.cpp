@@ -37,7 +37,10 @@ MethodCounters::MethodCounters(const methodHandle& mh) :
   JVMTI_ONLY(clear_number_of_breakpoints());
   invocation_counter()->init();
   backedge_counter()->init();
+  init_notify_masks(mh);
+}
 
+void MethodCounters::init_notify_masks(const methodHandle& mh) {
   // Set per-method thresholds.
   double scale = 1.0;
   CompilerOracle::has_option_value(mh, CompileCommand::CompileThresholdScaling, scale);
@@ -56,6 +59,24 @@ MethodCounters* MethodCounters::allocate_with_exception(const methodHandle& mh,
   return new(loader_data, method_counters_size(), MetaspaceObj::MethodCountersType, THREAD) MethodCounters(mh);
 }
 
+#if INCLUDE_CDS
+// Only the invocation and backedge counts are carried over from the training run.
+// The rate is relative to the timeline of the dumping JVM and the notification
+// masks depend on the runtime flags, so they are recomputed when the method is loaded.
+void MethodCounters::remove_unshareable_info() {
+  set_prev_time(0);
+  set_prev_event_count(0);
+  set_rate(0);
+  set_highest_comp_level(0);
+  set_highest_osr_comp_level(0);
+  JVMTI_ONLY(clear_number_of_breakpoints());
+}
+
+void MethodCounters::restore_unshareable_info(const methodHandle& mh) {
+  init_notify_masks(mh);
+}
+#endif
+
 void MethodCounters::clear_counters() {
   invocation_counter()->reset();
   backedge_counter()->reset();
@@ -52,9 +52,18 @@ class MethodCounters : public Metadata {
   u1                _highest_osr_comp_level;      // Same for OSR level
 
   MethodCounters(const methodHandle& mh);
+  void init_notify_masks(const methodHandle& mh);
  public:
+  // CDS and vtbl checking can create an empty MethodCounters to get vtbl pointer.
+  MethodCounters() {}
+
   virtual bool is_methodCounters() const { return true; }
 
+#if INCLUDE_CDS
+  void remove_unshareable_info();
+  void restore_unshareable_info(const methodHandle& mh);
+#endif
+
   static MethodCounters* allocate_no_exception(const methodHandle& mh);
   static MethodCounters* allocate_with_exception(const methodHandle& mh, TRAPS);
 
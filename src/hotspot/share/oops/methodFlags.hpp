@@ -58,6 +58,8 @@ class MethodFlags {
    status(has_loops_flag              , 1 << 13) /* Method has loops */ \
    status(has_loops_flag_init         , 1 << 14) /* The loop flag has been initialized */ \
    status(on_stack_flag               , 1 << 15) /* RedefineClasses support to keep Metadata from being cleaned */ \
+   status(has_archived_c1_compilation , 1 << 16) /* CDS: compiled at CompLevel_simple during the training run */ \
+   status(has_archived_c2_compilation , 1 << 17) /* CDS: compiled at CompLevel_full_optimization during the training run */ \
    /* end of list */
 
 #define M_STATUS_ENUM_NAME(name, value)    _misc_##name = value,
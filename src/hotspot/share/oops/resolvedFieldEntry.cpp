@@ -23,6 +23,9 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/archiveBuilder.hpp"
+#include "cds/archiveUtils.hpp"
+#include "cds/metaspaceShared.hpp"
 #include "resolvedFieldEntry.hpp"
 
 void ResolvedFieldEntry::print_on(outputStream* st) const {
@@ -48,3 +51,16 @@ void ResolvedFieldEntry::remove_unshareable_info() {
   memset(this, 0, sizeof(*this));
   _cpool_index = saved_cpool_index;
 }
+
+#if INCLUDE_CDS
+// The entry has been resolved at dump time and is stored in the archive (see
+// ClassPrelinker::can_archive_resolved_field()). _field_holder is not visited by
+// the MetaspaceClosure, so relocate it to the buffered copy of the holder here.
+void ResolvedFieldEntry::mark_and_relocate() {
+  assert(is_resolved(Bytecodes::_getfield) || is_resolved(Bytecodes::_putfield), "must be");
+  if (!MetaspaceShared::is_in_shared_metaspace(_field_holder)) {
+    _field_holder = ArchiveBuilder::current()->get_buffered_addr(_field_holder);
+  }
+  ArchivePtrMarker::mark_pointer(&_field_holder);
+}
+#endif
@@ -392,6 +392,28 @@ bool SuperWord::in_reduction_cycle(const Node* n, uint input) {
   return path_from_phi.first != nullptr;
 }
 
+bool SuperWord::is_reduction_moved_out_of_loop(const Node* n, uint vlen) {
+  const BasicType bt = n->bottom_type()->basic_type();
+  assert(bt == T_INT || bt == T_LONG, "only integral reductions are unordered");
+  // The loop needs the element-wise vector operation as accumulator.
+  const int vopc = VectorNode::opcode(n->Opcode(), bt);
+  if (!Matcher::match_rule_supported_vector(vopc, vlen, bt)) {
+    return false;
+  }
+  // The phi of the reduction cycle must not be used by anything but the
+  // cycle, or it cannot be turned into a vector phi.
+  auto has_my_opcode = [&](const Node* m){ return m->Opcode() == n->Opcode(); };
+  for (uint input = 1; input < n->req(); input++) {
+    PathEnd path_to_phi = find_in_path(n, input, LoopMaxUnroll, has_my_opcode,
+                                       [&](const Node* m) { return m->is_Phi(); });
+    const Node* phi = path_to_phi.first;
+    if (phi != nullptr) {
+      return phi->outcnt() == 1;
+    }
+  }
+  return false;
+}
+
 Node* SuperWord::original_input(const Node* n, uint i) {
   if (n->has_swapped_edges()) {
     assert(n->is_Add() || n->is_Mul(), "n should be commutative");
@@ -1927,7 +1949,10 @@ bool SuperWord::implemented(Node_List* p) {
     if (is_marked_reduction(p0)) {
       const Type *arith_type = p0->bottom_type();
       // Length 2 reductions of INT/LONG do not offer performance benefits
-      if (((arith_type->basic_type() == T_INT) || (arith_type->basic_type() == T_LONG)) && (size == 2)) {
+      // when they stay inside the loop.  They do pay off when the reduction
+      // is replaced by an element-wise vector accumulator in the loop.
+      if (((arith_type->basic_type() == T_INT) || (arith_type->basic_type() == T_LONG)) && (size == 2) &&
+          !is_reduction_moved_out_of_loop(p0, size)) {
         retValue = false;
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
@@ -429,6 +429,11 @@ class SuperWord : public ResourceObj {
   // Whether n is part of a reduction cycle via the 'input' edge index. To bound
   // the search, constrain the size of reduction cycles to LoopMaxUnroll.
   static bool in_reduction_cycle(const Node* n, uint input);
+  // Whether the reduction cycle through the INT or LONG reduction n will be
+  // turned into a vector accumulator with a single reduction after the loop
+  // once vectorized with vlen elements. See
+  // PhaseIdealLoop::move_unordered_reduction_out_of_loop.
+  static bool is_reduction_moved_out_of_loop(const Node* n, uint vlen);
   // Reference to the i'th input node of n, commuting the inputs of binary nodes
   // whose edges have been swapped. Assumes n is a commutative operation.
   static Node* original_input(const Node* n, uint i);
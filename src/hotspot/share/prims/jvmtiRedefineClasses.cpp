@@ -267,13 +267,22 @@ void VM_RedefineClasses::doit() {
     redefine_single_class(current, _class_defs[i].klass, _scratch_classes[i]);
   }
 
+  const bool log_timers = log_is_enabled(Info, redefine, class, timer);
+
   // Flush all compiled code that depends on the classes redefined.
+  if (log_timers) {
+    _timer_flush_dependent_code.start();
+  }
   flush_dependent_code();
+  _timer_flush_dependent_code.stop();
 
   // Adjust constantpool caches and vtables for all classes
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
+  if (log_timers) {
+    _timer_adjust_metadata.start();
+  }
   AdjustAndCleanMetadata adjust_and_clean_metadata(current);
   ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
 
@@ -282,6 +291,7 @@ void VM_RedefineClasses::doit() {
     bool trace_name_printed = false;
     ResolvedMethodTable::adjust_method_entries(&trace_name_printed);
   }
+  _timer_adjust_metadata.stop();
 
   // Increment flag indicating that some invariants are no longer true.
   // See jvmtiExport.hpp for detailed explanation.
@@ -326,6 +336,9 @@ void VM_RedefineClasses::doit_epilogue() {
     log_info(redefine, class, timer)
       ("redefine_single_class: phase1=" JULONG_FORMAT "  phase2=" JULONG_FORMAT,
        (julong)_timer_rsc_phase1.milliseconds(), (julong)_timer_rsc_phase2.milliseconds());
+    log_info(redefine, class, timer)
+      ("doit: flush_dependent_code=" JULONG_FORMAT "  adjust_metadata=" JULONG_FORMAT,
+       (julong)_timer_flush_dependent_code.milliseconds(), (julong)_timer_adjust_metadata.milliseconds());
   }
 }
 
@@ -3481,9 +3481,14 @@ void Arguments::init_shared_archive_paths() {
       // However, if either RecordDynamicDumpInfo or ArchiveClassesAtExit is used, we do not
       // allow cases (b) and (c). Case (b) is already checked above.
 
+      // Only two layers are supported. A layer that is shared by many applications
+      // (e.g., a framework) should be dumped into the static archive, with a classlist
+      // that contains both the JDK and framework classes, and each application's
+      // classes into a dynamic archive on top of it.
       if (archives > 2) {
         vm_exit_during_initialization(
-          "Cannot have more than 2 archive files specified in the -XX:SharedArchiveFile option");
+          "Cannot have more than 2 archive files specified in the -XX:SharedArchiveFile option",
+          "Only a static base archive and a dynamic top archive can be stacked");
       }
       if (archives == 1) {
         char* base_archive_path = nullptr;
@@ -1033,16 +1033,24 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
+  EventDeoptimizationHandshake event;
 
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  int count = CodeCache::make_marked_nmethods_deoptimized();
 
   DeoptimizeMarkedClosure deopt;
-  if (SafepointSynchronize::is_at_safepoint()) {
+  bool at_safepoint = SafepointSynchronize::is_at_safepoint();
+  if (at_safepoint) {
     Threads::java_threads_do(&deopt);
   } else {
     Handshake::execute(&deopt);
   }
+
+  if (event.should_commit()) {
+    event.set_methodCount(count);
+    event.set_atSafepoint(at_safepoint);
+    event.commit();
+  }
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
@@ -188,6 +188,23 @@ JVMFlag::Error CodeCacheSegmentSizeConstraintFunc(uintx value, bool verbose) {
   return JVMFlag::SUCCESS;
 }
 
+JVMFlag::Error InlineCacheBufferSizeConstraintFunc(size_t value, bool verbose) {
+  // The buffer is allocated in the non-nmethod code heap (or the single code
+  // heap), which it shares with the interpreter and the runtime stubs.
+  const size_t heap_size = SegmentedCodeCache ? NonNMethodCodeHeapSize : ReservedCodeCacheSize;
+  if (value > heap_size / 2) {
+    JVMFlag::printError(verbose,
+                        "InlineCacheBufferSize (" SIZE_FORMAT ") must be "
+                        "less than or equal to half of %s (" SIZE_FORMAT ")\n",
+                        value,
+                        SegmentedCodeCache ? "NonNMethodCodeHeapSize" : "ReservedCodeCacheSize",
+                        heap_size);
+    return JVMFlag::VIOLATES_CONSTRAINT;
+  }
+
+  return JVMFlag::SUCCESS;
+}
+
 JVMFlag::Error CodeEntryAlignmentConstraintFunc(intx value, bool verbose) {
   if (!is_power_of_2(value)) {
     JVMFlag::printError(verbose,
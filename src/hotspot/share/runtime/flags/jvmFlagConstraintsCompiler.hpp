@@ -41,6 +41,7 @@
   f(intx,  CompileThresholdConstraintFunc)              \
   f(intx,  OnStackReplacePercentageConstraintFunc)      \
   f(uintx, CodeCacheSegmentSizeConstraintFunc)          \
+  f(size_t, InlineCacheBufferSizeConstraintFunc)        \
   f(intx,  CodeEntryAlignmentConstraintFunc)            \
   f(intx,  OptoLoopAlignmentConstraintFunc)             \
   f(uintx, ArraycopyDstPrefetchDistanceConstraintFunc)  \
@@ -197,6 +197,10 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseNUMA, false,                                             \
           "Use NUMA if available")                                          \
                                                                             \
+  product(bool, UseNUMAThreadPlacement, false, EXPERIMENTAL,                \
+          "With UseNUMA, bind GC worker and compiler threads to the CPUs "  \
+          "of NUMA nodes, distributing them round-robin over the nodes")    \
+                                                                            \
   product(bool, UseNUMAInterleaving, false,                                 \
           "Interleave memory across NUMA nodes if available")               \
                                                                             \
@@ -889,6 +893,13 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
+  product(size_t, InlineCacheBufferSize, 10*K, EXPERIMENTAL,                \
+          "Size in bytes of the buffer holding inline cache transition "    \
+          "stubs. Each time it fills up, a safepoint is needed to clean "   \
+          "it")                                                             \
+          range(1*K, 16*M)                                                  \
+          constraint(InlineCacheBufferSizeConstraintFunc, AfterErgo)        \
+                                                                            \
   develop(bool, FLSVerifyDictionary, false,                                 \
           "Do lots of (expensive) FLS dictionary verification")             \
                                                                             \
@@ -927,9 +938,23 @@ const int ObjectAlignmentInBytes = 8;
           range(0, max_jint)                                                \
           constraint(CICompilerCountConstraintFunc, AfterErgo)              \
                                                                             \
+  product(bool, UseSecondarySuperCache, true, EXPERIMENTAL,                 \
+          "Remember the last secondary super found by a subtype check "     \
+          "scan in the sub klass. Turning this off avoids cache line "      \
+          "contention when many threads check different interfaces "        \
+          "against the same klass")                                         \
+                                                                            \
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(intx, CompilerThreadQueueWaitTarget, 0, EXPERIMENTAL,             \
+          "With UseDynamicNumberOfCompilerThreads, only add compiler "      \
+          "threads while tasks wait longer than this many milliseconds "    \
+          "in the compile queue on average, and use at most half of the "   \
+          "available processors for each compiler. 0 means the number "     \
+          "of threads only depends on the queue length")                    \
+          range(0, max_intx)                                                \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -1292,6 +1317,12 @@ const int ObjectAlignmentInBytes = 8;
           "(0 means none)")                                                 \
           range(0, max_jint)                                                \
                                                                             \
+  product(uint, SafepointStragglerSampleDelay, 0, DIAGNOSTIC,               \
+          "Sample the pc and method of threads in Java that have not "      \
+          "reached a safepoint after this many microseconds, and report "   \
+          "them in the safepoint log and as JFR events (0 = off)")          \
+          range(0, max_juint)                                               \
+                                                                            \
   product(double, SafepointTimeoutDelay, 10000,                             \
           "Delay in milliseconds for option SafepointTimeout; "             \
           "supports sub-millisecond resolution with fractional values.")    \
@@ -1991,6 +2022,13 @@ const int ObjectAlignmentInBytes = 8;
           "more eagerly at the cost of higher overhead. A value of 0 "      \
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
+                                                                            \
+  product(size_t, TrimNativeHeapFreeThreshold, 0, EXPERIMENTAL,             \
+          "If non-zero, periodic native heap trimming only trims when the " \
+          "C-heap retains at least this many free bytes, and backs off "    \
+          "the trim interval otherwise. Ignored on platforms that cannot "  \
+          "report free C-heap space.")                                      \
+          range(0, max_uintx)                                               \
 
 // end of RUNTIME_FLAGS
 
@@ -659,27 +659,39 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
 
   assert(op != nullptr, "Must have an op");
   assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
-  assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
 
-  log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
-                       op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+  // While we own the mutex the handshakee stays in its safe state, so
+  // process every pending operation in one go instead of claiming the
+  // handshake again for each of them.
+  bool executed_match_op = false;
+  int executed = 0;
+  do {
+    assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
 
-  op->prepare(_handshakee, current_thread);
+    log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
+                         op == match_op ? "handshaker" : "cooperative",
+                         current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
 
-  set_active_handshaker(current_thread);
-  op->do_handshake(_handshakee); // acquire, op removed after
-  set_active_handshaker(nullptr);
-  remove_op(op);
+    op->prepare(_handshakee, current_thread);
+
+    set_active_handshaker(current_thread);
+    op->do_handshake(_handshakee); // acquire, op removed after
+    set_active_handshaker(nullptr);
+    remove_op(op);
+
+    executed_match_op |= (op == match_op);
+    executed++;
+    op = get_op();
+  } while (op != nullptr);
 
   _lock.unlock();
 
-  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed an op for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
+  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed %d op(s) for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
                        current_thread->is_VM_thread() ? "VM Thread" : "JavaThread",
-                       p2i(current_thread), p2i(_handshakee),
-                       op == match_op ? "including" : "excluding", p2i(match_op));
+                       p2i(current_thread), executed, p2i(_handshakee),
+                       executed_match_op ? "including" : "excluding", p2i(match_op));
 
-  return op == match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
+  return executed_match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
 }
 
 void HandshakeState::do_self_suspend() {
@@ -2105,14 +2105,18 @@ void os::pretouch_memory(void* start, void* end, size_t page_size) {
     // We're doing concurrent-safe touch and memory state has page
     // granularity, so we can touch anywhere in a page.  Touch at the
     // beginning of each page to simplify iteration.
-    char* cur = static_cast<char*>(align_down(start, page_size));
+    void* first = align_down(start, page_size);
     void* last = align_down(static_cast<char*>(end) - 1, page_size);
-    assert(cur <= last, "invariant");
-    // Iterate from first page through last (inclusive), being careful to
-    // avoid overflow if the last page abuts the end of the address range.
-    for ( ; true; cur += page_size) {
-      Atomic::add(reinterpret_cast<int*>(cur), 0, memory_order_relaxed);
-      if (cur >= last) break;
+    assert(first <= last, "invariant");
+    const size_t pd_page_size = pd_pretouch_memory(first, last, page_size);
+    if (pd_page_size > 0) {
+      // Iterate from first page through last (inclusive), being careful to
+      // avoid overflow if the last page abuts the end of the address range.
+      last = align_down(static_cast<char*>(end) - 1, pd_page_size);
+      for (char* cur = static_cast<char*>(first); /* break */; cur += pd_page_size) {
+        Atomic::add(reinterpret_cast<int*>(cur), 0, memory_order_relaxed);
+        if (cur >= last) break;
+      }
     }
   }
 }
@@ -2175,6 +2179,29 @@ void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
 
+void os::numa_place_current_thread(uint index) {
+  if (!UseNUMA || !UseNUMAThreadPlacement) {
+    return;
+  }
+  const size_t num_groups = numa_get_groups_num();
+  if (num_groups <= 1) {
+    return;
+  }
+  uint* ids = NEW_C_HEAP_ARRAY(uint, num_groups, mtInternal);
+  const size_t num_ids = numa_get_leaf_groups(ids, num_groups);
+  if (num_ids > 0) {
+    const int lgrp_id = checked_cast<int>(ids[index % num_ids]);
+    if (numa_bind_current_thread(lgrp_id)) {
+      log_debug(os, thread)("Thread \"%s\" bound to NUMA node %d",
+                            Thread::current()->name(), lgrp_id);
+    } else {
+      log_debug(os, thread)("Failed to bind thread \"%s\" to NUMA node %d",
+                            Thread::current()->name(), lgrp_id);
+    }
+  }
+  FREE_C_HEAP_ARRAY(uint, ids);
+}
+
 char* os::reserve_memory_special(size_t size, size_t alignment, size_t page_size,
                                  char* addr, bool executable) {
 
@@ -224,6 +224,11 @@ class os: AllStatic {
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
+  // Platform-specific part of pretouch_memory for the page aligned range
+  // [first, last].  Returns the page size the common code should use to touch
+  // the range, or 0 if the range has already been handled.
+  static size_t pd_pretouch_memory(void* first, void* last, size_t page_size);
+
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
                                           char* addr, bool executable);
@@ -466,6 +471,10 @@ class os: AllStatic {
   struct size_change_t { size_t before; size_t after; };
   static bool trim_native_heap(size_change_t* rss_change = nullptr);
 
+  // Returns the number of free bytes the C-heap allocator retains and that
+  // trimming could return to the OS, or SIZE_MAX if that is unknown.
+  static size_t native_heap_free_bytes();
+
   // A diagnostic function to print memory mappings in the given range.
   static void print_memory_mappings(char* addr, size_t bytes, outputStream* st);
   // Prints all mappings
@@ -506,6 +515,12 @@ class os: AllStatic {
   static bool   unmap_memory(char *addr, size_t bytes);
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Hint that [addr, addr + bytes) will be accessed soon, so that the OS may start
+  // to read in the pages of a file mapping asynchronously.
+  static void   prefetch_memory(char *addr, size_t bytes);
+  // Number of minor and major page faults taken by the process so far.
+  // Returns false if the platform does not report them.
+  static bool   page_fault_counts(jlong* minor_faults, jlong* major_faults);
 
   // NUMA-specific interface
   static bool   numa_has_group_homing();
@@ -515,6 +530,12 @@ class os: AllStatic {
   static size_t numa_get_leaf_groups(uint *ids, size_t size);
   static bool   numa_topology_changed();
   static int    numa_get_group_id();
+  // Restrict the current thread to the CPUs of the given locality group.
+  // Returns false if that is not supported or failed.
+  static bool   numa_bind_current_thread(int lgrp_id);
+  // With UseNUMAThreadPlacement, bind the current thread to a locality group
+  // chosen round-robin by index.
+  static void   numa_place_current_thread(uint index);
   static int    numa_get_group_id_for_address(const void* address);
   static bool   numa_get_group_ids_for_range(const void** addresses, int* lgrp_ids, size_t count);
 
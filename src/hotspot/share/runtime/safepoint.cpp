@@ -40,6 +40,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -62,6 +63,7 @@
 #include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/suspendedThreadTask.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
@@ -115,6 +117,26 @@ static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask& event,
   }
 }
 
+static void post_safepoint_straggler_event(uint64_t safepoint_id,
+                                           JavaThread* thread,
+                                           jlong waited,
+                                           address pc,
+                                           Method* method,
+                                           int compile_id,
+                                           int bci) {
+  EventSafepointStraggler event;
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_straggler(JFR_THREAD_ID(thread));
+    event.set_waited(waited);
+    event.set_pc((u8)pc);
+    event.set_method(method);
+    event.set_compileId(compile_id);
+    event.set_bci(bci);
+    event.commit();
+  }
+}
+
 static void post_safepoint_end_event(EventSafepointEnd& event, uint64_t safepoint_id) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
@@ -215,6 +237,74 @@ static void back_off(int64_t start_time) {
   }
 }
 
+// Captures where a thread that keeps a safepoint waiting is running.
+// The thread is suspended while do_task() runs, so only the lock-free
+// code cache lookup is done there. The nmethod cannot go away while the
+// VM thread is synchronizing, so it is decoded after the thread resumed.
+class SafepointStragglerSampler : public SuspendedThreadTask {
+  address  _pc;
+  nmethod* _nm;
+
+ public:
+  SafepointStragglerSampler(JavaThread* thread) :
+    SuspendedThreadTask(thread), _pc(nullptr), _nm(nullptr) {}
+
+  void do_task(const SuspendedThreadTaskContext& context) {
+    JavaThread* jt = JavaThread::cast(context.thread());
+    if (jt->thread_state() != _thread_in_Java) {
+      return;
+    }
+    frame fr = os::fetch_frame_from_context(context.ucontext());
+    _pc = fr.pc();
+    if (_pc != nullptr) {
+      CodeBlob* cb = CodeCache::find_blob(_pc);
+      if (cb != nullptr && cb->is_nmethod()) {
+        _nm = cb->as_nmethod();
+      }
+    }
+  }
+
+  address pc() const  { return _pc; }
+  nmethod* nm() const { return _nm; }
+};
+
+void SafepointSynchronize::sample_stragglers(ThreadSafepointState* tss_head, jlong waited) {
+  ResourceMark rm;
+  for (ThreadSafepointState* cur_tss = tss_head; cur_tss != nullptr; cur_tss = cur_tss->get_next()) {
+    JavaThread* thread = cur_tss->thread();
+    if (thread->thread_state() != _thread_in_Java) {
+      continue;
+    }
+    SafepointStragglerSampler sampler(thread);
+    sampler.run();
+    if (sampler.pc() == nullptr) {
+      continue;
+    }
+
+    Method* method = nullptr;
+    int compile_id = 0;
+    int bci = InvocationEntryBci;
+    nmethod* nm = sampler.nm();
+    if (nm != nullptr) {
+      compile_id = nm->compile_id();
+      method = nm->method();
+      // The innermost scope at the next debug info point after the pc,
+      // e.g. the exit of a counted loop whose poll was eliminated.
+      ScopeDesc* sd = nm->scope_desc_near(sampler.pc());
+      if (sd != nullptr) {
+        method = sd->method();
+        bci = sd->bci();
+      }
+    }
+
+    log_info(safepoint)("Thread " INTPTR_FORMAT " %s has not reached safepoint after " JLONG_FORMAT " us, pc " INTPTR_FORMAT " %s (compile id %d, bci %d)",
+                        p2i(thread), thread->name(), waited / (NANOUNITS / MICROUNITS), p2i(sampler.pc()),
+                        method != nullptr ? method->external_name() : "<unknown>", compile_id, bci);
+    // The id of the safepoint being synchronized is only set once all threads are safe.
+    post_safepoint_straggler_event(_safepoint_id + 1, thread, waited, sampler.pc(), method, compile_id, bci);
+  }
+}
+
 int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
@@ -254,6 +344,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  bool stragglers_sampled = (SafepointStragglerSampleDelay == 0);
 
   do {
     // Check if this has taken too long:
@@ -261,6 +352,14 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       print_safepoint_timeout();
     }
 
+    if (!stragglers_sampled) {
+      jlong waited = os::javaTimeNanos() - start_time;
+      if (waited >= (jlong)SafepointStragglerSampleDelay * (NANOUNITS / MICROUNITS)) {
+        sample_stragglers(tss_head, waited);
+        stragglers_sampled = true;
+      }
+    }
+
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != nullptr) {
@@ -519,6 +618,15 @@ bool SafepointSynchronize::is_cleanup_needed() {
   return false;
 }
 
+// Names for SafepointSynchronize::SafepointCleanupTasks, used for tracing and the exit statistics.
+static const char* const cleanup_task_names[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS] = {
+  "lazy partial thread root processing",
+  "updating inline caches",
+  "rehashing symbol table",
+  "rehashing string table",
+  "requesting oop storage cleanup"
+};
+
 class ParallelCleanupTask : public WorkerTask {
 private:
   SubTasksDone _subtasks;
@@ -527,15 +635,20 @@ class ParallelCleanupTask : public WorkerTask {
   class Tracer {
   private:
     const char*               _name;
+    SafepointSynchronize::SafepointCleanupTasks _task;
+    jlong                     _start_ns;
     EventSafepointCleanupTask _event;
     TraceTime                 _timer;
 
   public:
-    Tracer(const char* name) :
-        _name(name),
+    Tracer(SafepointSynchronize::SafepointCleanupTasks task) :
+        _name(cleanup_task_names[task]),
+        _task(task),
+        _start_ns(os::javaTimeNanos()),
         _event(),
-        _timer(name, TRACETIME_LOG(Info, safepoint, cleanup)) {}
+        _timer(_name, TRACETIME_LOG(Info, safepoint, cleanup)) {}
     ~Tracer() {
+      SafepointTracing::cleanup_task_done(_task, os::javaTimeNanos() - _start_ns);
       post_safepoint_cleanup_task_event(_event, SafepointSynchronize::safepoint_id(), _name);
     }
   };
@@ -573,21 +686,21 @@ class ParallelCleanupTask : public WorkerTask {
     // These tasks are ordered by relative length of time to execute so that potentially longer tasks start first.
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_SYMBOL_TABLE_REHASH)) {
       if (SymbolTable::needs_rehashing()) {
-        Tracer t("rehashing symbol table");
+        Tracer t(SafepointSynchronize::SAFEPOINT_CLEANUP_SYMBOL_TABLE_REHASH);
         SymbolTable::rehash_table();
       }
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_STRING_TABLE_REHASH)) {
       if (StringTable::needs_rehashing()) {
-        Tracer t("rehashing string table");
+        Tracer t(SafepointSynchronize::SAFEPOINT_CLEANUP_STRING_TABLE_REHASH);
         StringTable::rehash_table();
       }
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING)) {
       if (_do_lazy_roots) {
-        Tracer t("lazy partial thread root processing");
+        Tracer t(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING);
         class LazyRootClosure : public ThreadClosure {
         public:
           void do_thread(Thread* thread) {
@@ -600,7 +713,7 @@ class ParallelCleanupTask : public WorkerTask {
     }
 
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES)) {
-      Tracer t("updating inline caches");
+      Tracer t(SafepointSynchronize::SAFEPOINT_CLEANUP_UPDATE_INLINE_CACHES);
       InlineCacheBuffer::update_inline_caches();
     }
 
@@ -1030,6 +1143,8 @@ jlong     SafepointTracing::_max_sync_time = 0;
 jlong     SafepointTracing::_max_cleanup_time = 0;
 jlong     SafepointTracing::_max_vmop_time = 0;
 uint64_t  SafepointTracing::_op_count[VM_Operation::VMOp_Terminating] = {0};
+uint64_t  SafepointTracing::_cleanup_task_count[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS] = {0};
+jlong     SafepointTracing::_cleanup_task_time[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS] = {0};
 
 void SafepointTracing::init() {
   // Application start
@@ -1099,6 +1214,13 @@ void SafepointTracing::statistics_exit_log() {
                               (int64_t)(_max_sync_time));
   log_info(safepoint, stats)("Maximum cleanup time  " INT64_FORMAT" ns",
                               (int64_t)(_max_cleanup_time));
+  for (int task = 0; task < SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS; task++) {
+    if (_cleanup_task_count[task] != 0) {
+      log_info(safepoint, stats)("Cleanup task %-36s" UINT64_FORMAT_W(10) " times, total " INT64_FORMAT " ns",
+                                  cleanup_task_names[task], _cleanup_task_count[task],
+                                  (int64_t)_cleanup_task_time[task]);
+    }
+  }
   log_info(safepoint, stats)("Maximum vm operation time (except for Exit VM operation)  "
                               INT64_FORMAT " ns",
                               (int64_t)(_max_vmop_time));
@@ -1127,6 +1249,12 @@ void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps)
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
+void SafepointTracing::cleanup_task_done(SafepointSynchronize::SafepointCleanupTasks task, jlong duration_ns) {
+  assert(task < SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS, "invalid task");
+  Atomic::inc(&_cleanup_task_count[task]);
+  Atomic::add(&_cleanup_task_time[task], duration_ns);
+}
+
 void SafepointTracing::cleanup() {
   _last_safepoint_cleanup_time_ns = os::javaTimeNanos();
 }
@@ -110,6 +110,7 @@ class SafepointSynchronize : AllStatic {
 
   // For debug long safepoint
   static void print_safepoint_timeout();
+  static void sample_stragglers(ThreadSafepointState* tss_head, jlong waited);
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
@@ -260,6 +261,10 @@ class SafepointTracing : public AllStatic {
   static jlong     _max_vmop_time;
   static uint64_t  _op_count[VM_Operation::VMOp_Terminating];
 
+  // Per cleanup task totals, indexed by SafepointSynchronize::SafepointCleanupTasks.
+  static uint64_t  _cleanup_task_count[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS];
+  static jlong     _cleanup_task_time[SafepointSynchronize::SAFEPOINT_CLEANUP_NUM_TASKS];
+
   static void statistics_log();
 
 public:
@@ -270,6 +275,9 @@ class SafepointTracing : public AllStatic {
   static void cleanup();
   static void end();
 
+  // Called by the (possibly parallel) cleanup workers for each task performed.
+  static void cleanup_task_done(SafepointSynchronize::SafepointCleanupTasks task, jlong duration_ns);
+
   static void statistics_exit_log();
 
   static jlong time_since_last_safepoint_ms() {
@@ -1676,6 +1676,9 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
     ls = &lsh_info;
   }
 
+  EventJavaMonitorDeflation event;
+  size_t in_use_before = _in_use_list.count();
+
   elapsedTimer timer;
   if (ls != nullptr) {
     ls->print_cr("begin deflating: in_use_list stats: ceiling=" SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
@@ -1775,6 +1778,15 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
   OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
+  if (event.should_commit()) {
+    event.set_inUseBefore(in_use_before);
+    event.set_inUseAfter(_in_use_list.count());
+    event.set_ceiling(in_use_list_ceiling());
+    event.set_deflated(deflated_count);
+    event.set_freed(deleted_count);
+    event.commit();
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
@@ -76,6 +76,7 @@ Thread::Thread() {
 
   // allocated data structures
   set_osthread(nullptr);
+  _cached_chunk = nullptr;
   set_resource_area(new (mtThread)ResourceArea());
   DEBUG_ONLY(_current_resource_mark = nullptr;)
   set_handle_area(new (mtThread) HandleArea(nullptr));
@@ -269,6 +270,9 @@ Thread::~Thread() {
   delete handle_area();
   delete metadata_handles();
 
+  // Hand back the cached arena chunk, after all arenas of this thread are gone.
+  Arena::flush_chunk_cache(this);
+
   // osthread() can be null, if creation of thread failed.
   if (osthread() != nullptr) os::free_thread(osthread());
 
@@ -43,6 +43,7 @@
 #include "jfr/support/jfrThreadExtension.hpp"
 #endif
 
+class Chunk;
 class CompilerThread;
 class HandleArea;
 class HandleMark;
@@ -402,6 +403,9 @@ class Thread: public ThreadShadow {
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  // Arena chunk cache, see ChunkPool
+  Chunk* volatile* cached_chunk_addr()           { return &_cached_chunk; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -525,6 +529,9 @@ class Thread: public ThreadShadow {
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // One standard-sized arena chunk kept in front of the global ChunkPools
+  Chunk* volatile _cached_chunk;
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
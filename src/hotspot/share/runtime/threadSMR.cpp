@@ -247,8 +247,12 @@ class AddThreadHazardPointerThreadClosure : public ThreadClosure {
 class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
  private:
   ThreadScanHashtable *_table;
+  // ThreadsLists whose JavaThreads have already been added to _table.
+  ThreadScanHashtable *_scanned_lists;
  public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table,
+                                             ThreadScanHashtable *scanned_lists) :
+    _table(table), _scanned_lists(scanned_lists) {}
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
@@ -288,6 +292,14 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
+    //
+    // Many threads usually share the same ThreadsList so only walk
+    // each ThreadsList once; otherwise this scan is quadratic in the
+    // number of threads.
+    if (_scanned_lists->has_entry((void*)current_list)) {
+      return;
+    }
+    _scanned_lists->add_entry((void*)current_list);
     AddThreadHazardPointerThreadClosure add_cl(_table);
     current_list->threads_do(&add_cl);
   }
@@ -951,8 +963,12 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
   }
 
+#ifdef ASSERT
+  // The validation is assert-only so skip the walk over all threads in
+  // product builds.
   ValidateHazardPtrsClosure validate_cl;
   threads_do(&validate_cl);
+#endif
 
   delete scan_table;
 }
@@ -966,7 +982,8 @@ bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   // Gather a hash table of the JavaThreads indirectly referenced by
   // hazard ptrs.
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  ThreadScanHashtable *scanned_lists = new ThreadScanHashtable();
+  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table, scanned_lists);
   threads_do(&scan_cl);
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
@@ -976,7 +993,8 @@ bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   // ThreadsListHandle in the search set.
   ThreadsList* current = _to_delete_list;
   while (current != nullptr) {
-    if (current->_nested_handle_cnt != 0) {
+    if (current->_nested_handle_cnt != 0 &&
+        !scanned_lists->has_entry((void*)current)) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
       AddThreadHazardPointerThreadClosure add_cl(scan_table);
@@ -989,6 +1007,7 @@ bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   if (scan_table->has_entry((void*)thread)) {
     thread_is_protected = true;
   }
+  delete scanned_lists;
   delete scan_table;
   return thread_is_protected;
 }
@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "cds/cds_globals.hpp"
+#include "cds/dynamicArchive.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
@@ -809,6 +810,11 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   //   take a while to process their first tick).
   WatcherThread::run_all_tasks();
 
+#if INCLUDE_CDS
+  // Start the thread that regenerates the -XX:+AutoCreateSharedArchive archive.
+  DynamicArchive::start_background_dump(CHECK_JNI_ERR);
+#endif
+
   create_vm_timer.end();
 #ifdef ASSERT
   _vm_complete = true;
@@ -47,12 +47,20 @@ class NativeHeapTrimmerThread : public NamedThread {
   // and the accuracy in tracking the trimming interval.
   static constexpr int64_t safepoint_poll_ms = 250;
 
+  // Upper limit for the factor by which the trim interval is stretched
+  // while the C-heap retains less free space than TrimNativeHeapFreeThreshold.
+  static constexpr unsigned max_backoff = 16;
+
   Monitor* const _lock;
   bool _stop;
   uint16_t _suspend_count;
 
+  // Current trim interval multiplier, see max_backoff.
+  unsigned _backoff;
+
   // Statistics
   uint64_t _num_trims_performed;
+  uint64_t _num_trims_skipped;
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -100,7 +108,7 @@ class NativeHeapTrimmerThread : public NamedThread {
 
     while (true) {
       double tnow = now();
-      double next_trim_time = tnow + interval_secs;
+      double next_trim_time = tnow + interval_secs * _backoff;
 
       unsigned times_suspended = 0;
       unsigned times_waited = 0;
@@ -133,8 +141,30 @@ class NativeHeapTrimmerThread : public NamedThread {
       log_trace(trimnative)("Times: %u suspended, %u timed, %u safepoint",
                             times_suspended, times_waited, times_safepoint);
 
-      execute_trim_and_log(tnow);
+      if (should_trim()) {
+        execute_trim_and_log(tnow);
+      }
+    }
+  }
+
+  // With TrimNativeHeapFreeThreshold set, only trim if the C-heap retains
+  // enough free space to make it worthwhile; otherwise back off.
+  bool should_trim() {
+    if (TrimNativeHeapFreeThreshold == 0) {
+      return true;
+    }
+    const size_t free_bytes = os::native_heap_free_bytes();
+    if (free_bytes == SIZE_MAX || free_bytes >= TrimNativeHeapFreeThreshold) {
+      _backoff = 1;
+      return true;
     }
+    _num_trims_skipped++;
+    _backoff = MIN2(_backoff * 2, max_backoff);
+    log_debug(trimnative)("Trim skipped: " PROPERFMT " free, below threshold " PROPERFMT
+                          ", next attempt in %u ms",
+                          PROPERFMTARGS(free_bytes), PROPERFMTARGS(TrimNativeHeapFreeThreshold),
+                          TrimNativeHeapInterval * _backoff);
+    return false;
   }
 
   // Execute the native trim, log results.
@@ -172,7 +202,9 @@ class NativeHeapTrimmerThread : public NamedThread {
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _backoff(1),
+    _num_trims_performed(0),
+    _num_trims_skipped(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -218,16 +250,21 @@ class NativeHeapTrimmerThread : public NamedThread {
     // Don't pull lock during error reporting
     Mutex* const lock = VMError::is_error_reported() ? nullptr : _lock;
     int64_t num_trims = 0;
+    int64_t num_skipped = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
     {
       MutexLocker ml(lock, Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_skipped = _num_trims_skipped;
       stopped = _stop;
       suspenders = _suspend_count;
     }
     st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
                  num_trims, suspenders, stopped);
+    if (TrimNativeHeapFreeThreshold > 0) {
+      st->print_cr("Trims skipped below free threshold: " UINT64_FORMAT, num_skipped);
+    }
   }
 
 }; // NativeHeapTrimmer
@@ -244,6 +281,14 @@ void NativeHeapTrimmer::initialize() {
     }
     g_trimmer_thread = new NativeHeapTrimmerThread();
     log_info(trimnative)("Periodic native trim enabled (interval: %u ms)", TrimNativeHeapInterval);
+    if (TrimNativeHeapFreeThreshold > 0) {
+      if (os::native_heap_free_bytes() == SIZE_MAX) {
+        log_info(trimnative)("C-heap free space unknown, TrimNativeHeapFreeThreshold ignored");
+      } else {
+        log_info(trimnative)("Trimming only with at least " PROPERFMT " free C-heap space",
+                             PROPERFMTARGS(TrimNativeHeapFreeThreshold));
+      }
+    }
   }
 }
 
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/cds_globals.hpp"
+#include "cds/cdsStatistics.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/classLoaderHierarchyDCmd.hpp"
 #include "classfile/classLoaderStats.hpp"
@@ -49,10 +50,12 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -551,12 +554,53 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "stop one thread at a time instead of all threads at a safepoint; "
+             "the stacks are not a consistent snapshot and -l and deadlock detection are not available",
+             "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
 }
 
+class PrintThreadStackClosure : public HandshakeClosure {
+  outputStream* _st;
+  bool _extended;
+public:
+  PrintThreadStackClosure(outputStream* st, bool extended) :
+    HandshakeClosure("PrintThreadStack"), _st(st), _extended(extended) {}
+  void do_thread(Thread* thr) {
+    JavaThread* jt = JavaThread::cast(thr);
+    ResourceMark rm;
+    jt->print_on(_st, _extended);
+    jt->print_stack_on(_st);
+    _st->cr();
+  }
+};
+
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value() && _locks.value()) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "-l cannot be used with -handshake");
+  }
+  if (_handshake.value()) {
+    // Each thread is only stopped while its own stack is printed, so the
+    // pause no longer grows with the number of threads.
+    char buf[32];
+    output()->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+    output()->print_cr("Thread dump %s (%s %s), per-thread handshakes:",
+                       VM_Version::vm_name(),
+                       VM_Version::vm_release(),
+                       VM_Version::vm_info_string());
+    output()->cr();
+    PrintThreadStackClosure cl(output(), _extended.value());
+    ThreadsListHandle tlh;
+    for (uint i = 0; i < tlh.length(); i++) {
+      Handshake::execute(&cl, &tlh, tlh.thread_at(i));
+    }
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
@@ -840,8 +884,18 @@ void CodeListDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_codelist(output());
 }
 
+CodeCacheDCmd::CodeCacheDCmd(outputStream* output, bool heap) :
+                             DCmdWithParser(output, heap),
+  _json("-json", "Print the layout as a single JSON object", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_json);
+}
+
 void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
-  CodeCache::print_layout(output());
+  if (_json.value()) {
+    CodeCache::print_layout_json(output());
+  } else {
+    CodeCache::print_layout(output());
+  }
 }
 
 #ifdef LINUX
@@ -980,7 +1034,7 @@ void ClassesDCmd::execute(DCmdSource source, TRAPS) {
 #if INCLUDE_CDS
 DumpSharedArchiveDCmd::DumpSharedArchiveDCmd(outputStream* output, bool heap) :
                                      DCmdWithParser(output, heap),
-  _suboption("subcmd", "static_dump | dynamic_dump", "STRING", true),
+  _suboption("subcmd", "static_dump | dynamic_dump | stats", "STRING", true),
   _filename("filename", "Name of shared archive to be dumped", "STRING", false)
 {
   _dcmdparser.add_dcmd_argument(&_suboption);
@@ -992,6 +1046,19 @@ void DumpSharedArchiveDCmd::execute(DCmdSource source, TRAPS) {
   const char* scmd = _suboption.value();
   const char* file = _filename.value();
 
+  if (strcmp(scmd, "stats") == 0) {
+    if (!UseSharedSpaces) {
+      output()->print_cr("CDS archive is not in use");
+      return;
+    }
+    if (!RecordCDSStatistics) {
+      output()->print_cr("CDS statistics are not recorded, use -XX:+RecordCDSStatistics");
+      return;
+    }
+    CDSStatistics::print_on(output());
+    return;
+  }
+
   if (strcmp(scmd, "static_dump") == 0) {
     is_static = JNI_TRUE;
     output()->print("Static dump: ");
@@ -1007,7 +1074,7 @@ void DumpSharedArchiveDCmd::execute(DCmdSource source, TRAPS) {
       return;
     }
   } else {
-    output()->print_cr("Invalid command for VM.cds, valid input is static_dump or dynamic_dump");
+    output()->print_cr("Invalid command for VM.cds, valid input is static_dump, dynamic_dump or stats");
     return;
   }
 
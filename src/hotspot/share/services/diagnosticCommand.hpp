@@ -407,7 +407,8 @@ class DumpSharedArchiveDCmd: public DCmdWithParser {
     return "VM.cds";
   }
   static const char* description() {
-    return "Dump a static or dynamic shared archive including all shareable classes";
+    return "Dump a static or dynamic shared archive including all shareable classes, "
+           "or print the time spent mapping and loading the shared archive(s)";
   }
   static const char* impact() {
     return "Medium: Pause time depends on number of loaded classes";
@@ -426,8 +427,9 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
   static const char* description() {
@@ -618,9 +620,12 @@ class CodeListDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
-class CodeCacheDCmd : public DCmd {
+class CodeCacheDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _json;
 public:
-  CodeCacheDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static int num_arguments() { return 1; }
+  CodeCacheDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "Compiler.codecache";
   }
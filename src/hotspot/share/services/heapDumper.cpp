@@ -635,6 +635,7 @@ class DumpWriter : public AbstractDumpWriter {
   void set_compressor(AbstractCompressor* p)   { _compressor = p; }
   bool is_overwrite() const                    { return _writer->is_overwrite(); }
   int get_fd() const                           { return _writer->get_fd(); }
+  bool is_regular_file() const                 { return _writer->is_regular_file(); }
 
   void flush() override;
 };
@@ -2181,6 +2182,12 @@ bool VM_HeapDumper::can_parallel_dump(WorkerThreads* workers) {
   if (num_active_workers <= 1 || num_requested_dump_threads <= 1) {
     _num_dumper_threads = 1;
     can_parallel = false;
+  } else if (!writer()->is_regular_file()) {
+    // A pipe or a device is streamed sequentially: segmented heap files
+    // would need extra disk space next to it and a merge phase, so dump the heap
+    // serially straight into the stream.
+    _num_dumper_threads = 1;
+    can_parallel = false;
   } else {
     // check if we have extra path room to accommodate segmented heap files
     const char* base_path = writer()->get_file_path();
@@ -30,10 +30,21 @@
 #include "utilities/zipLibrary.hpp"
 
 
+// A FIFO or a character device is written to rather than replaced, so it can be
+// used as the target without the overwrite option. Without it, the file would be
+// opened with O_EXCL, which fails since the path exists.
+static bool is_stream_path(char const* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return false;
+  }
+  return (st.st_mode & S_IFMT) == S_IFIFO || (st.st_mode & S_IFMT) == S_IFCHR;
+}
+
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, _overwrite);
+  _fd = os::create_binary_file(_path, _overwrite || is_stream_path(_path));
 
   if (_fd < 0) {
     return os::strerror(errno);
@@ -49,6 +60,16 @@ FileWriter::~FileWriter() {
   }
 }
 
+bool FileWriter::is_regular_file() const {
+  assert(_fd >= 0, "Must be open");
+  // Check the opened file rather than the path, which may have been replaced since.
+  struct stat st;
+  if (::fstat(_fd, &st) != 0) {
+    return false;
+  }
+  return (st.st_mode & S_IFMT) == S_IFREG;
+}
+
 char const* FileWriter::write_buf(char* buf, ssize_t size) {
   assert(_fd >= 0, "Must be open");
   assert(size > 0, "Must write at least one byte");
@@ -80,6 +80,10 @@ class FileWriter : public AbstractWriter {
 
   bool is_overwrite() const { return _overwrite; }
 
+  // Returns true if the opened file is a regular file. Pipes and character
+  // devices can only be written as a single sequential stream.
+  bool is_regular_file() const;
+
   int get_fd() const {return _fd; }
 };
 
@@ -481,16 +481,19 @@ void BitMap::set_intersection(const BitMap& other) {
 
 bool BitMap::set_union_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
+  // Accumulate the changed bits rather than a short-circuited flag, so that
+  // the loop has no data-dependent control flow and can be vectorized.
+  bm_word_t changed_bits = 0;
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig | other_map[index];
-    changed = changed || (temp != orig);
+    changed_bits |= temp ^ orig;
     dest_map[index] = temp;
   }
+  bool changed = changed_bits != 0;
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
@@ -503,16 +506,17 @@ bool BitMap::set_union_with_result(const BitMap& other) {
 
 bool BitMap::set_difference_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
+  bm_word_t changed_bits = 0;
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig & ~other_map[index];
-    changed = changed || (temp != orig);
+    changed_bits |= temp ^ orig;
     dest_map[index] = temp;
   }
+  bool changed = changed_bits != 0;
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
@@ -525,16 +529,17 @@ bool BitMap::set_difference_with_result(const BitMap& other) {
 
 bool BitMap::set_intersection_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
+  bm_word_t changed_bits = 0;
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig & other_map[index];
-    changed = changed || (temp != orig);
+    changed_bits |= temp ^ orig;
     dest_map[index] = temp;
   }
+  bool changed = changed_bits != 0;
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
@@ -104,49 +104,53 @@ class CopySwap : AllStatic {
    */
   template <typename T, CopyDirection D, bool swap, bool is_src_aligned, bool is_dst_aligned>
   static void do_conjoint_swap(const void* src, void* dst, size_t byte_count) {
-    const char* cur_src;
-    char* cur_dst;
-
-    switch (D) {
-    case RIGHT:
-      cur_src = (const char*)src;
-      cur_dst = (char*)dst;
-      break;
-    case LEFT:
-      cur_src = (const char*)src + byte_count - sizeof(T);
-      cur_dst = (char*)dst + byte_count - sizeof(T);
-      break;
-    }
-
-    for (size_t i = 0; i < byte_count / sizeof(T); i++) {
-      T tmp;
-
-      if (is_src_aligned) {
-        tmp = *(T*)cur_src;
-      } else {
-        memcpy(&tmp, cur_src, sizeof(T));
-      }
-
-      if (swap) {
-        tmp = byteswap(tmp);
-      }
-
-      if (is_dst_aligned) {
-        *(T*)cur_dst = tmp;
-      } else {
-        memcpy(cur_dst, &tmp, sizeof(T));
-      }
-
+    // The elements are moved in blocks through a local buffer. Each block is
+    // read completely before any of it is written, so overlapping copies stay
+    // correct as long as the blocks are visited in direction D. And since the
+    // buffer cannot alias src or dst, the compiler may vectorize the two
+    // inner loops, including the byte swap.
+    const size_t block_elems = 32;
+    T buf[block_elems];
+
+    size_t remaining = byte_count / sizeof(T);
+    size_t done = 0;
+    while (remaining > 0) {
+      const size_t n = MIN2(remaining, block_elems);
+      size_t first; // index of the first element of this block
       switch (D) {
       case RIGHT:
-        cur_src += sizeof(T);
-        cur_dst += sizeof(T);
+        first = done;
         break;
       case LEFT:
-        cur_src -= sizeof(T);
-        cur_dst -= sizeof(T);
+        first = remaining - n;
         break;
       }
+      const char* cur_src = (const char*)src + first * sizeof(T);
+      char* cur_dst = (char*)dst + first * sizeof(T);
+
+      for (size_t i = 0; i < n; i++) {
+        T tmp;
+        if (is_src_aligned) {
+          tmp = ((const T*)cur_src)[i];
+        } else {
+          memcpy(&tmp, cur_src + i * sizeof(T), sizeof(T));
+        }
+        if (swap) {
+          tmp = byteswap(tmp);
+        }
+        buf[i] = tmp;
+      }
+
+      for (size_t i = 0; i < n; i++) {
+        if (is_dst_aligned) {
+          ((T*)cur_dst)[i] = buf[i];
+        } else {
+          memcpy(cur_dst + i * sizeof(T), &buf[i], sizeof(T));
+        }
+      }
+
+      remaining -= n;
+      done += n;
     }
   }
 
@@ -25,6 +25,8 @@
 
 #include <sys/sendfile.h>
 #include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 #include "jni.h"
 #include "nio.h"
@@ -60,6 +62,17 @@ Java_sun_nio_ch_FileDispatcherImpl_transferFrom0(JNIEnv *env, jobject this,
     off64_t offset = (off64_t)position;
     size_t len = (size_t)count;
     jlong n = my_copy_file_range_func(srcFD, NULL, dstFD, &offset, len, 0);
+    if (n < 0 && errno == EINVAL) {
+        // copy_file_range does not accept a pipe as the source, but splice
+        // moves its pages into a regular file without a user-space copy.
+        struct stat64 src_stat, dst_stat;
+        if (fstat64(srcFD, &src_stat) == 0 && S_ISFIFO(src_stat.st_mode) &&
+            fstat64(dstFD, &dst_stat) == 0 && S_ISREG(dst_stat.st_mode)) {
+            n = splice(srcFD, NULL, dstFD, &offset, len, SPLICE_F_MOVE);
+        } else {
+            errno = EINVAL;
+        }
+    }
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
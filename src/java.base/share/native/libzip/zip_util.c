@@ -1697,3 +1697,42 @@ ZIP_GZip_Fully(char* inBuf, size_t inLen, char* outBuf, size_t outLen, char* tmp
 
   return result;
 }
+
+JNIEXPORT size_t
+ZIP_GUnzip_Fully(char* inBuf, size_t inLen, char* outBuf, size_t outLen, char const** pmsg) {
+  z_stream strm;
+  int err;
+  size_t result = 0;
+
+  memset(&strm, 0, sizeof(z_stream));
+  *pmsg = NULL;
+
+  err = inflateInit2(&strm, 31);
+
+  if (err == Z_MEM_ERROR) {
+    *pmsg = "Out of memory in inflateInit2";
+  } else if (err != Z_OK) {
+    *pmsg = "Internal error in inflateInit2";
+  } else {
+    strm.next_out = (Bytef *) outBuf;
+    strm.avail_out = (uInt) outLen;
+    strm.next_in = (Bytef *) inBuf;
+    strm.avail_in = (uInt) inLen;
+
+    err = inflate(&strm, Z_FINISH);
+
+    if (err == Z_OK || err == Z_BUF_ERROR) {
+      *pmsg = "Buffer too small";
+    } else if (err == Z_DATA_ERROR) {
+      *pmsg = "Compressed data corrupted";
+    } else if (err != Z_STREAM_END) {
+      *pmsg = "Intern inflate error";
+    } else {
+      result = (size_t) strm.total_out;
+    }
+
+    inflateEnd(&strm);
+  }
+
+  return result;
+}
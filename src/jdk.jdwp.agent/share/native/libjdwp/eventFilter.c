@@ -561,6 +561,26 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
     return JNI_TRUE;
 }
 
+/**
+ * Return true if any of the node's filters matches on the class name,
+ * so that callers only look up the class signature when it is needed.
+ */
+jboolean
+eventFilterRestricted_needsClassname(HandlerNode *node)
+{
+    Filter *filter = FILTERS_ARRAY(node);
+    int i;
+
+    for (i = 0; i < FILTER_COUNT(node); ++i, ++filter) {
+        switch (filter->modifier) {
+            case JDWP_REQUEST_MODIFIER(ClassMatch):
+            case JDWP_REQUEST_MODIFIER(ClassExclude):
+                return JNI_TRUE;
+        }
+    }
+    return JNI_FALSE;
+}
+
 /* Determine if this event is interesting to this handler.  Do so
  * by checking each of the handler's filters.  Return false if any
  * of the filters fail, true if the handler wants this event.
@@ -49,5 +49,6 @@ jboolean eventFilterRestricted_passesUnloadFilter(JNIEnv *env,
 jboolean eventFilterRestricted_isBreakpointInClass(JNIEnv *env,
                                                    jclass clazz,
                                                    HandlerNode *node);
+jboolean eventFilterRestricted_needsClassname(HandlerNode *node);
 
 #endif
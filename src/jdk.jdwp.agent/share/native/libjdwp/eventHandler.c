@@ -549,9 +549,11 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
     {
         HandlerNode *node;
         char        *classname;
+        jboolean     classnameFetched;
 
         node = getHandlerChain(ei)->first;
-        classname = getClassname(evinfo->clazz);
+        classname = NULL;
+        classnameFetched = JNI_FALSE;
 
         /* Filter the event over each handler node. */
         while (node != NULL) {
@@ -559,6 +561,15 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
+            /*
+             * Looking up the class signature is a JVMTI call per event,
+             * so only do it once a node with a class name filter is seen.
+             */
+            if (!classnameFetched && eventFilterRestricted_needsClassname(node)) {
+                classname = getClassname(evinfo->clazz);
+                classnameFetched = JNI_TRUE;
+            }
+
             if (eventFilterRestricted_passesFilter(env, classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
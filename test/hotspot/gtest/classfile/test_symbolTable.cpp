@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "threadHelper.inline.hpp"
@@ -139,3 +140,19 @@ TEST_VM(SymbolTable, test_cleanup_leak) {
 
   ASSERT_EQ(entry2->refcount(), 1) << "Symbol refcount just created is 1";
 }
+
+TEST(SymbolTable, hash_code_matches_string_hash) {
+  // The unrolled byte hash must agree with String.hashCode() for every
+  // length and for bytes with the high bit set.
+  jbyte buf[64];
+  for (int i = 0; i < (int)ARRAY_SIZE(buf); i++) {
+    buf[i] = (jbyte)(i * 37 + 0x81);
+  }
+  for (int len = 0; len <= (int)ARRAY_SIZE(buf); len++) {
+    unsigned int expected = 0;
+    for (int i = 0; i < len; i++) {
+      expected = 31 * expected + (((unsigned int) buf[i]) & 0xFF);
+    }
+    ASSERT_EQ(expected, java_lang_String::hash_code(buf, len)) << "length " << len;
+  }
+}
@@ -33,3 +33,27 @@ TEST_VM(G1Analytics, is_initialized) {
   ASSERT_EQ(a.long_term_pause_time_ratio(), 0.0);
   ASSERT_EQ(a.short_term_pause_time_ratio(), 0.0);
 }
+
+TEST_VM(G1Analytics, alloc_rate_forecast) {
+  G1Predictions p(0.5);
+  G1Analytics a(&p);
+  // Not enough samples for a forecast yet.
+  a.report_alloc_rate_ms(1.0);
+  a.report_alloc_rate_ms(1.0);
+  ASSERT_EQ(a.forecast_alloc_rate_ms(), 0.0);
+
+  // A constant allocation rate is forecast unchanged.
+  a.report_alloc_rate_ms(1.0);
+  ASSERT_DOUBLE_EQ(a.forecast_alloc_rate_ms(), 1.0);
+
+  // A rising allocation rate is followed by the trend.
+  a.report_alloc_rate_ms(2.0);
+  a.report_alloc_rate_ms(3.0);
+  ASSERT_GT(a.forecast_alloc_rate_ms(), 2.0);
+
+  // A falling allocation rate never yields a negative forecast.
+  for (int i = 0; i < 10; i++) {
+    a.report_alloc_rate_ms(0.0);
+  }
+  ASSERT_GE(a.forecast_alloc_rate_ms(), 0.0);
+}
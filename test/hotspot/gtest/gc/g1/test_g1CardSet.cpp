@@ -78,6 +78,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_small_array_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -378,6 +379,32 @@ void G1CardSetTest::cardset_basic_test() {
     card_set.iterate_cards(count_cards);
     ASSERT_TRUE(count_cards._num_cards == config.max_cards_in_region());
 
+    card_set.clear();
+    ASSERT_TRUE(card_set.occupied() == 0);
+  }
+  { // Test batched adds across all coarsening steps
+    G1CardSet card_set(&config, &mm);
+
+    const uint BatchSize = 37;
+    uint cards[BatchSize];
+    uint count = 0;
+    for (uint i = 0; i < CardsPerRegion; i += BatchSize - 1) {
+      uint num_cards = 0;
+      // Overlap every batch by one card with the previous one.
+      for (uint j = (i == 0) ? i : i - 1; j < MIN2(i + BatchSize - 1, CardsPerRegion); j++) {
+        cards[num_cards++] = j;
+      }
+      count += card_set.add_cards(98, cards, num_cards);
+      ASSERT_TRUE(count == card_set.occupied());
+    }
+    ASSERT_TRUE(CardsPerRegion == card_set.occupied());
+
+    for (uint i = 0; i < CardsPerRegion; i++) {
+      ASSERT_TRUE(card_set.contains_card(98, i));
+    }
+
+    check_iteration(&card_set, card_set.occupied());
+
     card_set.clear();
     ASSERT_TRUE(card_set.occupied() == 0);
   }
@@ -479,6 +506,40 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+void G1CardSetTest::cardset_small_array_test() {
+  const uint CardsPerRegion = 2048;
+  const uint CardsInArray = 28;
+
+  G1CardSetConfiguration config(CardsInArray, 0.9, 8, 0.8, CardsPerRegion, 0);
+  ASSERT_LT(config.max_cards_in_small_array(), config.max_cards_in_array());
+  ASSERT_GT(config.max_cards_in_small_array(), config.max_cards_in_inline_ptr());
+
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+  G1CardSet card_set(&config, &mm);
+
+  // Overflow the inline pointer: the cards now use a small array.
+  uint region_idx = 7;
+  uint num_cards = config.max_cards_in_inline_ptr() + 1;
+  for (uint i = 0; i < num_cards; i++) {
+    ASSERT_EQ(card_set.add_card(region_idx, i), Added);
+  }
+  ASSERT_GT(card_set.small_array_saved_mem_size(), 0u);
+
+  // Overflow the small array: the cards are transferred to a full sized one.
+  num_cards = config.max_cards_in_small_array() + 1;
+  for (uint i = config.max_cards_in_inline_ptr() + 1; i < num_cards; i++) {
+    ASSERT_EQ(card_set.add_card(region_idx, i), Added);
+  }
+  ASSERT_EQ(card_set.small_array_saved_mem_size(), 0u);
+  for (uint i = 0; i < num_cards; i++) {
+    ASSERT_TRUE(card_set.contains_card(region_idx, i));
+  }
+  ASSERT_EQ(card_set.occupied(), num_cards);
+
+  check_iteration(&card_set, num_cards);
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +547,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, small_array_cardset_test) {
+  G1CardSetTest::cardset_small_array_test();
+}
@@ -1034,6 +1034,36 @@ TEST_VM_F(OopStorageTestWithAllocation, delete_empty_blocks) {
   EXPECT_EQ(initial_active_size - 3, storage().block_count());
 }
 
+TEST_VM_F(OopStorageTestWithAllocation, sparse_block_moved_back) {
+  ASSERT_LE(3u, active_count(storage())); // Need at least 3 blocks for test
+  AllocationList& allocation_list = TestAccess::allocation_list(storage());
+  const OopBlock* sparse = TestAccess::active_array(storage()).at(0);
+  const OopBlock* dense = TestAccess::active_array(storage()).at(1);
+  ASSERT_TRUE(TestAccess::block_is_full(*sparse));
+  ASSERT_TRUE(TestAccess::block_is_full(*dense));
+
+  // Release one entry of the second block, and all but one entry of the
+  // first block.  Both become candidates for allocation again, but the
+  // mostly empty one must be behind the other.
+  release_entry(storage(), _entries[BitsPerWord]);
+  for (size_t i = 1; i < BitsPerWord; ++i) {
+    release_entry(storage(), _entries[i]);
+  }
+  EXPECT_EQ(1u, TestAccess::block_allocation_count(*sparse));
+  EXPECT_TRUE(allocation_list.contains(*sparse));
+  EXPECT_TRUE(allocation_list.contains(*dense));
+  EXPECT_NE(sparse, allocation_list.chead());
+  EXPECT_TRUE(is_allocation_list_sorted(storage()));
+
+  // The dense block must be found before the sparse one.
+  const OopBlock* block = allocation_list.chead();
+  while ((block != dense) && (block != sparse)) {
+    block = allocation_list.next(*block);
+    ASSERT_NE(NULL_BLOCK, block);
+  }
+  EXPECT_EQ(dense, block);
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, allocation_status) {
   oop* retained = _entries[200];
   oop* released = _entries[300];
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=int
+ * @key randomness
+ * @summary Two-element INT reductions that SuperWord moves out of the loop must
+ *          compute the same results as the scalar loop.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:MaxVectorSize=8
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestTwoElementReductions::ref*
+ *                   compiler.loopopts.superword.TestTwoElementReductions
+ */
+
+/*
+ * @test id=long
+ * @key randomness
+ * @summary Two-element LONG reductions that SuperWord moves out of the loop must
+ *          compute the same results as the scalar loop.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:MaxVectorSize=16
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestTwoElementReductions::ref*
+ *                   compiler.loopopts.superword.TestTwoElementReductions
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+import jdk.test.lib.Utils;
+
+public class TestTwoElementReductions {
+    static final int SIZE = 1027;
+    static final int ITERATIONS = 20_000;
+    static final Random RANDOM = Utils.getRandomInstance();
+
+    static int[] ia = new int[SIZE];
+    static long[] la = new long[SIZE];
+
+    // The test methods are compiled by C2 with MaxVectorSize limiting the vectors to two
+    // lanes; the ref* methods are excluded from compilation and run in the interpreter.
+
+    static int addInt(int[] a)  { int r = 0;  for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static int mulInt(int[] a)  { int r = 1;  for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static int andInt(int[] a)  { int r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static int orInt(int[] a)   { int r = 0;  for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static int xorInt(int[] a)  { int r = 0;  for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+
+    static long addLong(long[] a) { long r = 0;  for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static long mulLong(long[] a) { long r = 1;  for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static long andLong(long[] a) { long r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static long orLong(long[] a)  { long r = 0;  for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static long xorLong(long[] a) { long r = 0;  for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+
+    static int refAddInt(int[] a)  { int r = 0;  for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static int refMulInt(int[] a)  { int r = 1;  for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static int refAndInt(int[] a)  { int r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static int refOrInt(int[] a)   { int r = 0;  for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static int refXorInt(int[] a)  { int r = 0;  for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+
+    static long refAddLong(long[] a) { long r = 0;  for (int i = 0; i < a.length; i++) { r += a[i]; } return r; }
+    static long refMulLong(long[] a) { long r = 1;  for (int i = 0; i < a.length; i++) { r *= a[i]; } return r; }
+    static long refAndLong(long[] a) { long r = -1; for (int i = 0; i < a.length; i++) { r &= a[i]; } return r; }
+    static long refOrLong(long[] a)  { long r = 0;  for (int i = 0; i < a.length; i++) { r |= a[i]; } return r; }
+    static long refXorLong(long[] a) { long r = 0;  for (int i = 0; i < a.length; i++) { r ^= a[i]; } return r; }
+
+    static void fill() {
+        for (int i = 0; i < SIZE; i++) {
+            // Mostly odd values keep the products from collapsing to zero, and
+            // mostly set bits keep the and-reductions interesting.
+            ia[i] = RANDOM.nextInt() | (RANDOM.nextInt(8) == 0 ? 0 : 0x10001);
+            la[i] = RANDOM.nextLong() | (RANDOM.nextInt(8) == 0 ? 0 : 0x100000001L);
+        }
+    }
+
+    static void verify(String op, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(op + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        long[] expected = new long[10];
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            if (iter % 1000 == 0) {
+                fill();
+                expected[0] = refAddInt(ia);
+                expected[1] = refMulInt(ia);
+                expected[2] = refAndInt(ia);
+                expected[3] = refOrInt(ia);
+                expected[4] = refXorInt(ia);
+                expected[5] = refAddLong(la);
+                expected[6] = refMulLong(la);
+                expected[7] = refAndLong(la);
+                expected[8] = refOrLong(la);
+                expected[9] = refXorLong(la);
+            }
+            verify("addInt",  expected[0], addInt(ia));
+            verify("mulInt",  expected[1], mulInt(ia));
+            verify("andInt",  expected[2], andInt(ia));
+            verify("orInt",   expected[3], orInt(ia));
+            verify("xorInt",  expected[4], xorInt(ia));
+            verify("addLong", expected[5], addLong(la));
+            verify("mulLong", expected[6], mulLong(la));
+            verify("andLong", expected[7], andLong(la));
+            verify("orLong",  expected[8], orLong(la));
+            verify("xorLong", expected[9], xorLong(la));
+        }
+    }
+}
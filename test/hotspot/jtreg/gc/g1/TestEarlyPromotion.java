@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEarlyPromotion
+ * @summary With G1EarlyPromotion, objects of classes whose instances survive their second young GC are promoted at that GC, for every later cohort.
+ *          Without it, they are not. NeverTenure keeps the age based tenuring threshold from promoting them.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -Xmx128m -Xmn32m -XX:+NeverTenure
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+G1EarlyPromotion -Xlog:gc+age=debug
+ *                   gc.g1.TestEarlyPromotion true
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -Xmx128m -Xmn32m -XX:+NeverTenure
+ *                   -XX:+UnlockExperimentalVMOptions -XX:-G1EarlyPromotion -Xlog:gc+age=debug
+ *                   gc.g1.TestEarlyPromotion false
+ */
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestEarlyPromotion {
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    static class LongLived {
+        long value;
+        LongLived(long value) { this.value = value; }
+    }
+
+    // A cohort takes about 0.5MB, so that it fits into the survivor space and
+    // is never promoted because of survivor space overflow.
+    private static LongLived[] allocate() {
+        LongLived[] objects = new LongLived[20_000];
+        for (int i = 0; i < objects.length; i++) {
+            objects[i] = new LongLived(i);
+        }
+        return objects;
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean earlyPromotion = Boolean.parseBoolean(args[0]);
+
+        // Teach G1 that LongLived instances survive their second young GC.
+        LongLived[] first = allocate();
+        WB.youngGC();
+        WB.youngGC();
+        if (WB.isObjectInOldGen(first[0])) {
+            throw new RuntimeException("Objects must not be promoted before a decision has been made");
+        }
+        first = null;
+
+        // With G1EarlyPromotion, every later cohort of new instances is promoted at
+        // its second young GC. Each cohort is judged by its own survival, so the
+        // decision must stay in effect while the cohorts keep surviving. Without
+        // G1EarlyPromotion, the cohorts stay in the survivor space.
+        for (int cohort = 1; cohort <= 4; cohort++) {
+            LongLived[] objects = allocate();
+            WB.youngGC();
+            if (WB.isObjectInOldGen(objects[0])) {
+                throw new RuntimeException("Cohort " + cohort + ": objects must not be promoted at their first young GC");
+            }
+            WB.youngGC();
+            int promoted = 0;
+            for (LongLived object : objects) {
+                if (WB.isObjectInOldGen(object)) {
+                    promoted++;
+                }
+            }
+            System.out.println("Cohort " + cohort + ": promoted " + promoted + " of " + objects.length + " objects");
+            if (earlyPromotion && promoted != objects.length) {
+                throw new RuntimeException("Cohort " + cohort + ": all objects should have been promoted early, but only " +
+                                           promoted + " were");
+            }
+            if (!earlyPromotion && promoted != 0) {
+                throw new RuntimeException("Cohort " + cohort + ": no objects should have been promoted, but " +
+                                           promoted + " were");
+            }
+        }
+    }
+}
@@ -55,7 +55,7 @@ public static void main(String[] args) throws Exception {
 
         OutputAnalyzer output = new OutputAnalyzer(pb.start());
         System.out.println(output.getStdout());
-        output.shouldContain("(Evacuation Failure)");
+        output.shouldContain("(Evacuation Failure: Allocation)");
         output.shouldHaveExitValue(0);
     }
 
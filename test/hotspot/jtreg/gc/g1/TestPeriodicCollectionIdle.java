@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestPeriodicCollectionIdle
+ * @requires vm.gc.G1
+ * @summary Verify that G1PeriodicGCIdleInterval does not trigger periodic collections
+ *          while the application allocates, and triggers one once it is idle.
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestPeriodicCollectionIdle
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPeriodicCollectionIdle {
+
+    private static final String IDLE_MARKER = "Application is idle now";
+    private static final String PERIODIC_GC = "G1 Periodic Collection";
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UseG1GC", "-Xmx64m", "-Xmn8m",
+            "-XX:+UnlockExperimentalVMOptions", "-XX:G1PeriodicGCIdleInterval=2000",
+            "-Xlog:gc,gc+periodic=debug",
+            BusyThenIdle.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String stdout = output.getStdout();
+        int idleStart = stdout.indexOf(IDLE_MARKER);
+        if (idleStart < 0) {
+            throw new RuntimeException("Missing idle marker");
+        }
+        String busy = stdout.substring(0, idleStart);
+        String idle = stdout.substring(idleStart);
+        if (!busy.contains("Pause Young")) {
+            throw new RuntimeException("The busy phase should have had young collections");
+        }
+        if (busy.contains(PERIODIC_GC)) {
+            throw new RuntimeException("No periodic collection expected while the application allocates");
+        }
+        if (!idle.contains(PERIODIC_GC)) {
+            throw new RuntimeException("A periodic collection expected once the application is idle");
+        }
+    }
+
+    static class BusyThenIdle {
+        static volatile Object sink;
+
+        public static void main(String[] args) throws Exception {
+            // Allocate steadily for 8 seconds, which is four idle intervals. The
+            // young collections keep the heap usage from growing between samples.
+            List<byte[]> window = new ArrayList<>();
+            long end = System.nanoTime() + 8_000_000_000L;
+            while (System.nanoTime() < end) {
+                for (int i = 0; i < 1000; i++) {
+                    window.add(new byte[1024]);
+                    if (window.size() > 1000) {
+                        window.remove(0);
+                    }
+                }
+                sink = window;
+                Thread.sleep(1);
+            }
+            window = null;
+            sink = null;
+
+            System.out.println(IDLE_MARKER);
+            Thread.sleep(6000);
+        }
+    }
+}
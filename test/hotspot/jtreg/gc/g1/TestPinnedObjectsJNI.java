@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/* @test
+ * @summary Test that young and full collections proceed while objects are pinned
+ * by JNI critical sections, and that the pinned objects do not move.
+ * @requires vm.gc.G1
+ * @run main/othervm/native
+ *    -XX:+UseG1GC -Xmx64m -Xmn8m
+ *    -Xlog:gc
+ *    gc.g1.TestPinnedObjectsJNI
+ */
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+
+public class TestPinnedObjectsJNI {
+    static { System.loadLibrary("TestPinnedObjectsJNI"); }
+
+    // Pins the array, signals that it has done so and waits for unblock().
+    // Then writes the given value into the first element through the pointer
+    // obtained when pinning.
+    private static native boolean pinInNative(int[] array, int value);
+    private static native boolean isPinned();
+    private static native void unblock();
+
+    private static Object[] garbage = new Object[1024];
+
+    private static long collectionCount() {
+        long count = 0;
+        for (GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += bean.getCollectionCount();
+        }
+        return count;
+    }
+
+    public static void main(String[] args) throws Exception {
+        final int[] pinned = new int[16];
+        final int value = 0x12345678;
+
+        Thread pinner = new Thread(() -> {
+            if (!pinInNative(pinned, value)) {
+                throw new RuntimeException("failed to pin array");
+            }
+        });
+        pinner.start();
+
+        while (!isPinned()) {
+            Thread.sleep(10);
+        }
+
+        long before = collectionCount();
+        try {
+            // While the array is pinned, allocate enough to cause several young
+            // collections, and request a full collection.
+            for (int i = 0; i < 256 * 1024; i++) {
+                garbage[i % garbage.length] = new byte[1024];
+            }
+            System.gc();
+        } finally {
+            unblock();
+        }
+        pinner.join();
+
+        long after = collectionCount();
+        if (after <= before) {
+            throw new RuntimeException("No collection happened while the array was pinned");
+        }
+        if (pinned[0] != value) {
+            throw new RuntimeException("Pinned array has been moved: expected " + value + " but got " + pinned[0]);
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test -XX:+ArchiveCompilations: the methods compiled during the training run
+ *          are recorded in the classlist, and compiled when their holder is initialized.
+ *          The C2 compilations are replayed with profiling, as no profile is archived.
+ * @requires vm.cds
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @requires vm.opt.TieredStopAtLevel == null & vm.opt.TieredCompilation != false
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @build ArchiveCompilationsTest
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar compilations.jar ArchiveCompilationsApp
+ * @run driver ArchiveCompilationsTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.helpers.ClassFileInstaller;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ArchiveCompilationsTest {
+    public static void main(String[] args) throws Exception {
+        String appJar = ClassFileInstaller.getJarPath("compilations.jar");
+        String classlist = "ArchiveCompilationsTest.classlist";
+
+        // Training run: work() becomes hot and is compiled by C2.
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+            "-XX:DumpLoadedClassList=" + classlist, "-XX:+ArchiveCompilations", "-Xbatch",
+            "-cp", appJar, "ArchiveCompilationsApp", "train");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        List<String> lines = Files.readAllLines(Path.of(classlist));
+        boolean found = false;
+        for (String line : lines) {
+            if (line.startsWith("@compiled-method ") && line.contains(" work ()I ") && line.endsWith(" 4")) {
+                found = true;
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No @compiled-method line for the C2 compilation of work() in " + classlist);
+        }
+
+        output = TestCommon.dump(appJar, lines.toArray(new String[0]));
+        TestCommon.checkDump(output);
+
+        // work() is called only once, so it's compiled only because it's replayed. It has
+        // not been profiled in this run, so it's compiled at CompLevel_full_profile.
+        output = TestCommon.exec(appJar, "-XX:+ArchiveCompilations", "-XX:+PrintCompilation",
+                                 "ArchiveCompilationsApp", "once");
+        if (TestCommon.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("\\s3\\s+ArchiveCompilationsApp::work \\(");
+        output.shouldNotMatch("\\s4\\s+ArchiveCompilationsApp::work \\(");
+
+        // Without the flag, the recorded compilations are ignored.
+        output = TestCommon.exec(appJar, "-XX:+PrintCompilation", "ArchiveCompilationsApp", "once");
+        if (TestCommon.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("ArchiveCompilationsApp::work");
+    }
+}
+
+class ArchiveCompilationsApp {
+    static int sum;
+
+    static int work() {
+        int s = 0;
+        for (int i = 0; i < 100; i++) {
+            s += i * sum;
+        }
+        return s;
+    }
+
+    public static void main(String[] args) {
+        int iterations = args[0].equals("train") ? 100_000 : 1;
+        for (int i = 0; i < iterations; i++) {
+            sum += work();
+        }
+        System.out.println("sum = " + sum);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test -XX:AutoCreateSharedArchiveDelay: the dynamic archive of
+ *          -XX:+AutoCreateSharedArchive is created by a background thread.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build AutoCreateSharedArchiveDelay
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar delayed.jar AutoCreateSharedArchiveDelayApp
+ * @run driver AutoCreateSharedArchiveDelay
+ */
+
+import java.io.File;
+import jdk.test.lib.helpers.ClassFileInstaller;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AutoCreateSharedArchiveDelay {
+    static String appJar;
+
+    public static void main(String[] args) throws Exception {
+        appJar = ClassFileInstaller.getJarPath("delayed.jar");
+
+        // The background thread dumps the archive one second after startup,
+        // while the application is still running.
+        File archive = new File("background.jsa");
+        OutputAnalyzer output = run(archive, 1, 10);
+        output.shouldContain("Preparing for dynamic dump in background thread");
+        output.shouldContain("Dynamic archive " + archive.getPath() + " has been created in the background");
+        output.shouldContain("Dynamic archive has been dumped by the background thread");
+        output.shouldNotContain("Preparing for dynamic dump at exit");
+        checkArchive(archive);
+
+        // The archive is up to date, so it is used and not dumped again.
+        output = run(archive, 1, 0);
+        output.shouldContain("AutoCreateSharedArchiveDelayApp source: shared objects file (top)");
+        output.shouldNotContain("Preparing for dynamic dump");
+
+        // The application exits before the delay has elapsed, so the archive
+        // is dumped at exit.
+        archive = new File("at-exit.jsa");
+        output = run(archive, 3600, 0);
+        output.shouldNotContain("Preparing for dynamic dump in background thread");
+        output.shouldContain("Preparing for dynamic dump at exit");
+        checkArchive(archive);
+    }
+
+    static OutputAnalyzer run(File archive, int delay, int sleepSeconds) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+            "-XX:+AutoCreateSharedArchive",
+            "-XX:SharedArchiveFile=" + archive.getPath(),
+            "-XX:AutoCreateSharedArchiveDelay=" + delay,
+            "-Xlog:cds+dynamic=info,class+load=info",
+            "-cp", appJar,
+            "AutoCreateSharedArchiveDelayApp", Integer.toString(sleepSeconds));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Hello from AutoCreateSharedArchiveDelayApp");
+        return output;
+    }
+
+    static void checkArchive(File archive) {
+        if (!archive.isFile()) {
+            throw new RuntimeException(archive + " has not been created");
+        }
+        String prefix = archive.getName() + ".";
+        String[] leftovers = new File(".").getAbsoluteFile().list((dir, name) ->
+            name.startsWith(prefix) && name.endsWith(".tmp"));
+        if (leftovers != null && leftovers.length > 0) {
+            throw new RuntimeException("Temporary archive file left behind: " + leftovers[0]);
+        }
+    }
+}
+
+class AutoCreateSharedArchiveDelayApp {
+    public static void main(String[] args) throws Exception {
+        System.out.println("Hello from AutoCreateSharedArchiveDelayApp");
+        Thread.sleep(Integer.parseInt(args[0]) * 1000L);
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test -XX:PreInitializeArchivedClasses: the static state of the selected
+ *          classes is restored from the archive without running <clinit>.
+ * @requires vm.cds.write.archived.java.heap
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @build PreInitializeArchivedClasses
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar preinit.jar
+ *             PreInitApp PreInitGood PreInitNonFinal PreInitClassRef
+ * @run driver PreInitializeArchivedClasses
+ */
+
+import jdk.test.lib.helpers.ClassFileInstaller;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class PreInitializeArchivedClasses {
+    public static void main(String[] args) throws Exception {
+        String appJar = ClassFileInstaller.getJarPath("preinit.jar");
+        String[] classlist = TestCommon.list("PreInitApp", "PreInitGood", "PreInitNonFinal", "PreInitClassRef");
+
+        OutputAnalyzer output = TestCommon.dump(appJar, classlist,
+            "-XX:PreInitializeArchivedClasses=PreInitGood,PreInitNonFinal,PreInitClassRef,NoSuchClass",
+            "-Xlog:cds=info");
+        TestCommon.checkDump(output);
+        output.shouldContain("PreInitGood.<clinit>");
+        output.shouldContain("Pre-initialized PreInitGood");
+        output.shouldContain("Cannot pre-initialize PreInitNonFinal: has non-final static fields");
+        output.shouldContain("Cannot pre-initialize PreInitClassRef: references a java.lang.Class object");
+        output.shouldContain("Cannot pre-initialize NoSuchClass: class not found");
+
+        output = TestCommon.exec(appJar, "-Xlog:cds+heap=info", "PreInitApp");
+        if (TestCommon.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Initializing pre-initialized class: PreInitGood");
+        output.shouldContain("PreInitGood: 42 value-42 [1, 2, 3] 3.5");
+        output.shouldNotContain("PreInitGood.<clinit>");
+        // The rejected classes are initialized as usual.
+        output.shouldContain("PreInitNonFinal.<clinit>");
+        output.shouldContain("PreInitNonFinal: 1");
+        output.shouldContain("PreInitClassRef.<clinit>");
+        output.shouldContain("PreInitClassRef: java.lang.String");
+    }
+}
+
+class PreInitApp {
+    public static void main(String[] args) {
+        System.out.println("PreInitGood: " + PreInitGood.INT + " " + PreInitGood.STRING + " " +
+                           java.util.Arrays.toString(PreInitGood.ARRAY) + " " + PreInitGood.DOUBLE);
+        System.out.println("PreInitNonFinal: " + PreInitNonFinal.counter);
+        System.out.println("PreInitClassRef: " + PreInitClassRef.CLASS.getName());
+    }
+}
+
+class PreInitGood {
+    static final int INT;
+    static final String STRING;
+    static final int[] ARRAY;
+    static final double DOUBLE;
+
+    static {
+        System.out.println("PreInitGood.<clinit>");
+        // Not compile-time constants, so they are set by <clinit>.
+        INT = Integer.parseInt("42");
+        STRING = "value-" + INT;
+        ARRAY = new int[] {1, 2, 3};
+        DOUBLE = Double.parseDouble("3.5");
+    }
+}
+
+class PreInitNonFinal {
+    static int counter;
+
+    static {
+        System.out.println("PreInitNonFinal.<clinit>");
+        counter = 1;
+    }
+}
+
+class PreInitClassRef {
+    static final Class<?> CLASS;
+
+    static {
+        System.out.println("PreInitClassRef.<clinit>");
+        CLASS = String.class;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary The archived heap objects are streamed into the heap of a collector that can
+ *          neither map nor load the archived heap region, and are disabled if the heap
+ *          is too small to stream them.
+ * @requires vm.cds.write.archived.java.heap
+ * @requires vm.gc.Serial & vm.gc.Z
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @build StreamArchivedHeap
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar stream.jar StreamArchivedHeapApp
+ * @run driver StreamArchivedHeap
+ */
+
+import jdk.test.lib.helpers.ClassFileInstaller;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class StreamArchivedHeap {
+    public static void main(String[] args) throws Exception {
+        String appJar = ClassFileInstaller.getJarPath("stream.jar");
+        String[] classlist = TestCommon.list("StreamArchivedHeapApp");
+
+        // ZGC doesn't use compressed oops, so the archive must be dumped without them.
+        OutputAnalyzer output = TestCommon.dump(appJar, classlist,
+            "-XX:+UseSerialGC", "-XX:-UseCompressedOops");
+        TestCommon.checkDump(output);
+
+        output = TestCommon.exec(appJar, "-XX:+UseZGC", "-XX:-UseCompressedOops",
+                                 "-Xlog:cds=info", "StreamArchivedHeapApp");
+        if (TestCommon.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Streamed heap +region");
+        output.shouldContain("Materialized");
+        output.shouldContain("full module graph: enabled");
+        output.shouldContain("StreamArchivedHeapApp: done");
+
+        // The region takes more than a quarter of this heap, so it's not streamed, and
+        // the VM starts without the archived objects.
+        output = TestCommon.exec(appJar, "-XX:+UseZGC", "-XX:-UseCompressedOops", "-Xmx4m",
+                                 "-Xlog:cds=info", "StreamArchivedHeapApp");
+        if (TestCommon.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Cannot stream heap region");
+        output.shouldNotContain("Materialized");
+        output.shouldContain("StreamArchivedHeapApp: done");
+    }
+}
+
+class StreamArchivedHeapApp {
+    public static void main(String[] args) {
+        // Uses the archived module graph, mirrors and interned strings when they are available.
+        String s = new String(new char[] {'d', 'o', 'n', 'e'}).intern();
+        System.out.println("StreamArchivedHeapApp: " + s + " " + Integer.valueOf(100).equals(100));
+    }
+}
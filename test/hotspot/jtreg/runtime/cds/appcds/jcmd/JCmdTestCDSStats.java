@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test "jcmd VM.cds stats" with and without -XX:+RecordCDSStatistics.
+ * @requires vm.cds
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -Xshare:auto -XX:+RecordCDSStatistics JCmdTestCDSStats true
+ * @run main/othervm -Xshare:auto JCmdTestCDSStats false
+ */
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class JCmdTestCDSStats {
+    public static void main(String[] args) throws Exception {
+        boolean recording = Boolean.parseBoolean(args[0]);
+        OutputAnalyzer output = new PidJcmdExecutor().execute("VM.cds stats");
+        if (output.getStdout().contains("CDS archive is not in use")) {
+            System.out.println("Skipped: the default CDS archive could not be mapped");
+            return;
+        }
+        if (recording) {
+            output.shouldMatch("Phase\\s+Count\\s+Time \\(ms\\)");
+            // The static archive has been mapped and classes have been loaded from it.
+            output.shouldMatch("mapRegions\\s+[1-9]\\d*\\s");
+            output.shouldMatch("restoreClasses\\s+[1-9]\\d*\\s");
+        } else {
+            output.shouldContain("CDS statistics are not recorded, use -XX:+RecordCDSStatistics");
+            output.shouldNotContain("mapRegions");
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test id=segmented
+ * @summary Test of diagnostic command Compiler.codecache -json
+ * @requires vm.flavor == "server"
+ * @requires vm.opt.TieredCompilation != false & vm.opt.TieredStopAtLevel == null
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+SegmentedCodeCache CodeCacheJsonTest 3
+ */
+
+/*
+ * @test id=nonsegmented
+ * @summary Test of diagnostic command Compiler.codecache -json
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:-SegmentedCodeCache CodeCacheJsonTest 1
+ */
+public class CodeCacheJsonTest {
+    static final Pattern HEAP = Pattern.compile(
+        "\\{\"name\":\"([^\"]+)\",\"size\":(\\d+),\"used\":(\\d+),\"max_used\":(\\d+),\"free\":(\\d+),\"full_count\":(\\d+)\\}");
+    static final Pattern TOTALS = Pattern.compile(
+        "\"total_blobs\":(\\d+),\"nmethods\":(\\d+),\"adapters\":(\\d+)," +
+        "\"compilation_enabled\":(true|false),\"stopped_count\":(\\d+),\"restarted_count\":(\\d+)," +
+        "\"queue_sizes\":\\{\"c1\":(\\d+),\"c2\":(\\d+)\\}\\}$");
+
+    public static void main(String[] args) throws Exception {
+        int expectedHeaps = Integer.parseInt(args[0]);
+
+        // jcmd prints the pid of the target VM on the first line.
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Compiler.codecache -json");
+        List<String> lines = output.asLines();
+        String json = lines.get(lines.size() - 1).trim();
+        if (!json.startsWith("{\"heaps\":[")) {
+            throw new RuntimeException("Expected a single JSON object, got: " + output.getStdout());
+        }
+
+        List<String> names = new ArrayList<>();
+        Matcher m = HEAP.matcher(json);
+        while (m.find()) {
+            String name = m.group(1);
+            long size = Long.parseLong(m.group(2));
+            long used = Long.parseLong(m.group(3));
+            long maxUsed = Long.parseLong(m.group(4));
+            long free = Long.parseLong(m.group(5));
+            if (size <= 0 || used + free != size || maxUsed > size) {
+                throw new RuntimeException("Inconsistent sizes for " + name + ": " + m.group());
+            }
+            names.add(name);
+        }
+        if (names.size() != expectedHeaps) {
+            throw new RuntimeException("Expected " + expectedHeaps + " heaps, got " + names + " in " + json);
+        }
+
+        m = TOTALS.matcher(json);
+        if (!m.find()) {
+            throw new RuntimeException("Missing totals or queue sizes in " + json);
+        }
+        long blobs = Long.parseLong(m.group(1));
+        long nmethods = Long.parseLong(m.group(2));
+        long adapters = Long.parseLong(m.group(3));
+        if (blobs < nmethods + adapters) {
+            throw new RuntimeException("total_blobs is smaller than nmethods + adapters in " + json);
+        }
+        if (!m.group(4).equals("true")) {
+            throw new RuntimeException("Compilation should be enabled: " + json);
+        }
+        // The queue sizes are matched as non-negative integers above.
+    }
+}
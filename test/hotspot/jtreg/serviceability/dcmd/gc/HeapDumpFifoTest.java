@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicReference;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.heap_dump into a FIFO: the heap is streamed
+ *          serially without segment files, and -overwrite is not needed.
+ * @requires os.family != "windows"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm HeapDumpFifoTest
+ */
+public class HeapDumpFifoTest {
+    public static void main(String[] args) throws Exception {
+        File fifo = new File("heapdump.fifo");
+        fifo.delete();
+        Process mkfifo = new ProcessBuilder("mkfifo", fifo.getPath()).inheritIO().start();
+        if (mkfifo.waitFor() != 0) {
+            throw new RuntimeException("mkfifo failed");
+        }
+
+        AtomicLong size = new AtomicLong();
+        AtomicReference<byte[]> header = new AtomicReference<>();
+        Thread reader = new Thread(() -> {
+            try (InputStream in = new FileInputStream(fifo)) {
+                byte[] buf = new byte[64 * 1024];
+                int n;
+                while ((n = in.read(buf)) > 0) {
+                    if (header.get() == null) {
+                        header.set(Arrays.copyOf(buf, n));
+                    }
+                    size.addAndGet(n);
+                }
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+        });
+        reader.start();
+
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+        OutputAnalyzer output = executor.execute("GC.heap_dump -parallel=4 " + fifo.getAbsolutePath());
+        reader.join();
+
+        output.shouldContain("Heap dump file created");
+        output.shouldNotContain("File exists");
+        if (size.get() == 0) {
+            throw new RuntimeException("Nothing was written into the FIFO");
+        }
+        String magic = new String(header.get(), 0, Math.min(header.get().length, 12), StandardCharsets.US_ASCII);
+        if (!magic.equals("JAVA PROFILE")) {
+            throw new RuntimeException("Not an HPROF stream: " + magic);
+        }
+        File segment = new File(fifo.getAbsolutePath() + ".p0");
+        if (segment.exists()) {
+            throw new RuntimeException("Unexpected segment file " + segment);
+        }
+        fifo.delete();
+    }
+}
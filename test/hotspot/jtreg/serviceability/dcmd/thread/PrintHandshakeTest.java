@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.concurrent.CountDownLatch;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Thread.print -handshake
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm PrintHandshakeTest
+ */
+public class PrintHandshakeTest {
+    static final String THREAD_NAME = "PrintHandshakeTest-waiter";
+    static final Object lock = new Object();
+    static final CountDownLatch waiting = new CountDownLatch(1);
+
+    static void waitForever() throws InterruptedException {
+        synchronized (lock) {
+            waiting.countDown();
+            lock.wait();
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Thread waiter = new Thread(() -> {
+            try {
+                waitForever();
+            } catch (InterruptedException e) {
+                // Done
+            }
+        }, THREAD_NAME);
+        waiter.setDaemon(true);
+        waiter.start();
+        waiting.await();
+
+        PidJcmdExecutor executor = new PidJcmdExecutor();
+
+        OutputAnalyzer output = executor.execute("Thread.print -handshake");
+        output.shouldContain("per-thread handshakes");
+        output.shouldContain("\"" + THREAD_NAME + "\"");
+        output.shouldContain("PrintHandshakeTest.waitForever");
+        output.shouldContain("\"main\"");
+        output.shouldNotContain("Found one Java-level deadlock");
+
+        output = executor.execute("Thread.print -handshake -e");
+        output.shouldContain("per-thread handshakes");
+        output.shouldContain("\"" + THREAD_NAME + "\"");
+
+        output = executor.execute("Thread.print -handshake -l");
+        output.shouldContain("java.lang.IllegalArgumentException: -l cannot be used with -handshake");
+        output.shouldNotContain("per-thread handshakes");
+
+        waiter.interrupt();
+        waiter.join();
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/* @test
+ * @summary Test FileChannel.transferFrom from a FIFO into a file, and from a
+ *          file into a FileChannel of a pipe
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @build jdk.test.lib.process.ProcessTools
+ * @run main TransferFromPipe
+ */
+
+import java.io.FileDescriptor;
+import java.io.FileOutputStream;
+import java.io.OutputStream;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import static java.nio.file.StandardOpenOption.*;
+
+public class TransferFromPipe {
+    private static final int SIZE = 1024 * 1024 + 17;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 2 && args[0].equals("child")) {
+            // Copy the file to stdout, which the parent has connected to a pipe.
+            Path source = Path.of(args[1]);
+            try (FileChannel src = FileChannel.open(source, READ);
+                 FileChannel dst = new FileOutputStream(FileDescriptor.out).getChannel()) {
+                long size = src.size();
+                long transferred = 0;
+                while (transferred < size) {
+                    transferred += dst.transferFrom(src, transferred, size - transferred);
+                }
+            }
+            return;
+        }
+
+        byte[] data = new byte[SIZE];
+        new Random(42).nextBytes(data);
+
+        fifoToFile(data);
+        fileToPipe(data);
+    }
+
+    // The source is a FIFO, the destination a regular file.
+    static void fifoToFile(byte[] data) throws Exception {
+        Path dir = Files.createTempDirectory(Path.of("."), "TransferFromPipe");
+        Path fifo = dir.resolve("fifo");
+        Path target = dir.resolve("target");
+        Process mkfifo = new ProcessBuilder("mkfifo", fifo.toString()).inheritIO().start();
+        if (!mkfifo.waitFor(60, TimeUnit.SECONDS) || mkfifo.exitValue() != 0) {
+            throw new RuntimeException("mkfifo failed");
+        }
+
+        Thread writer = new Thread(() -> {
+            try (OutputStream out = Files.newOutputStream(fifo)) {
+                out.write(data);
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+        });
+        writer.start();
+
+        try (FileChannel src = FileChannel.open(fifo, READ);
+             FileChannel dst = FileChannel.open(target, CREATE_NEW, WRITE)) {
+            long transferred = 0;
+            while (transferred < data.length) {
+                long n = dst.transferFrom(src, transferred, data.length - transferred);
+                if (n == 0) {
+                    break;
+                }
+                transferred += n;
+            }
+        }
+        writer.join();
+
+        if (!Arrays.equals(data, Files.readAllBytes(target))) {
+            throw new RuntimeException("FIFO to file: contents differ");
+        }
+    }
+
+    // The source is a regular file, the destination the stdout of a child
+    // process, which is a pipe.
+    static void fileToPipe(byte[] data) throws Exception {
+        Path source = Files.createTempFile(Path.of("."), "TransferFromPipe", ".src");
+        Files.write(source, data);
+
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+                TransferFromPipe.class.getName(), "child", source.toString());
+        Process p = pb.start();
+        byte[] output = p.getInputStream().readAllBytes();
+        OutputAnalyzer oa = new OutputAnalyzer(p);
+        oa.shouldHaveExitValue(0);
+
+        if (!Arrays.equals(data, output)) {
+            throw new RuntimeException("File to pipe: got " + output.length + " bytes, expected " + data.length);
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures G1 young collection copy throughput with and without prefetching
+ * of task referents in the evacuation loop (G1EvacuationPrefetchDistance).
+ *
+ * Every operation replaces one of many linked lists whose nodes are linked in
+ * random allocation order, so that the live set stays young and evacuating it
+ * touches memory in an order the hardware prefetchers cannot predict. Run with
+ * "-prof gc" or -Xlog:gc to compare pause times next to throughput.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 10, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Benchmark)
+public class G1EvacuationPrefetch {
+
+    static class Node {
+        Node next;
+        Object payload;
+    }
+
+    @Param({"256"})
+    public int lists;
+
+    @Param({"4096"})
+    public int listLength;
+
+    private Node[] heads;
+    private int[] order;
+    private int nextList;
+
+    @Setup
+    public void setup() {
+        heads = new Node[lists];
+        order = new int[listLength];
+        for (int i = 0; i < listLength; i++) {
+            order[i] = i;
+        }
+        Random random = new Random(42);
+        for (int i = listLength - 1; i > 0; i--) {
+            int j = random.nextInt(i + 1);
+            int t = order[i];
+            order[i] = order[j];
+            order[j] = t;
+        }
+        for (int i = 0; i < lists; i++) {
+            replaceList();
+        }
+    }
+
+    private Node replaceList() {
+        Node[] nodes = new Node[listLength];
+        for (int i = 0; i < listLength; i++) {
+            nodes[i] = new Node();
+            nodes[i].payload = new int[2];
+        }
+        for (int i = 1; i < listLength; i++) {
+            nodes[order[i - 1]].next = nodes[order[i]];
+        }
+        Node head = nodes[order[0]];
+        heads[nextList] = head;
+        nextList = (nextList + 1) % lists;
+        return head;
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC", "-Xmx2g", "-Xmn256m",
+                                       "-XX:+UnlockExperimentalVMOptions", "-XX:G1EvacuationPrefetchDistance=0" })
+    public Node noPrefetch() {
+        return replaceList();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC", "-Xmx2g", "-Xmn256m",
+                                       "-XX:+UnlockExperimentalVMOptions", "-XX:G1EvacuationPrefetchDistance=4" })
+    public Node prefetch4() {
+        return replaceList();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC", "-Xmx2g", "-Xmn256m",
+                                       "-XX:+UnlockExperimentalVMOptions", "-XX:G1EvacuationPrefetchDistance=8" })
+    public Node prefetch8() {
+        return replaceList();
+    }
+}